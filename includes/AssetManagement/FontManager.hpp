@@ -1,7 +1,9 @@
 #pragma once
 
+#include "./GlyphAtlas.hpp"
 #include <SDL_ttf.h>
 #include <filesystem>
+#include <memory>
 #include <string>
 
 typedef std::filesystem::path Path;
@@ -13,12 +15,23 @@ private:
   TTF_Font *m_font_md = nullptr;
   TTF_Font *m_font_sm = nullptr;
 
+  std::unique_ptr<GlyphAtlas> m_atlas_lg;
+  std::unique_ptr<GlyphAtlas> m_atlas_md;
+  std::unique_ptr<GlyphAtlas> m_atlas_sm;
+
 public:
-  explicit FontManager(const Path &fontPath);
+  // Glyph atlases are textures, so they are built for `renderer` and must not outlive it
+  FontManager(const Path &fontPath, SDL_Renderer *renderer);
   ~FontManager();
 
   void      loadFonts(const Path &fontPath);
+  void      buildGlyphAtlases(SDL_Renderer *renderer);
   TTF_Font *getFontLg() const;
   TTF_Font *getFontMd() const;
   TTF_Font *getFontSm() const;
+
+  // Null when the fonts failed to load
+  const GlyphAtlas *getGlyphAtlasLg() const;
+  const GlyphAtlas *getGlyphAtlasMd() const;
+  const GlyphAtlas *getGlyphAtlasSm() const;
 };
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "../Helpers/Vec2.hpp"
+#include <SDL2/SDL.h>
+#include <SDL_ttf.h>
+#include <array>
+#include <string>
+#include <vector>
+
+/**
+ * @brief All printable ASCII glyphs of one font, rasterized once into a single texture.
+ *
+ * Glyphs are rendered white, and text is drawn as one `SDL_RenderCopy` per character with
+ * the texture's color and alpha modulated to the requested color. Drawing text therefore
+ * never creates surfaces or textures. Characters outside the atlas are drawn as '?'.
+ *
+ * Kerning between every pair of glyphs is looked up once, so text is laid out the same way
+ * as `TTF_RenderText_Solid` lays it out.
+ */
+class GlyphAtlas {
+  static constexpr char   FIRST_GLYPH = ' ';
+  static constexpr char   LAST_GLYPH  = '~';
+  static constexpr size_t GLYPH_COUNT = LAST_GLYPH - FIRST_GLYPH + 1;
+
+  struct Glyph {
+    SDL_Rect source  = {};
+    int      advance = 0;
+  };
+
+  TTF_Font                      *m_font    = nullptr;
+  SDL_Texture                   *m_texture = nullptr;
+  std::array<Glyph, GLYPH_COUNT> m_glyphs;
+
+  // Pen adjustment between two glyphs, at `previous * GLYPH_COUNT + current`
+  std::vector<int> m_kerning;
+
+  static size_t getGlyphIndex(char character);
+
+public:
+  /**
+   * @throws std::runtime_error If a glyph or the atlas texture could not be created.
+   */
+  GlyphAtlas(SDL_Renderer *renderer, TTF_Font *font);
+  ~GlyphAtlas();
+
+  GlyphAtlas(const GlyphAtlas &)            = delete;
+  GlyphAtlas &operator=(const GlyphAtlas &) = delete;
+
+  void renderText(SDL_Renderer      *renderer,
+                  const std::string &text,
+                  const SDL_Color   &color,
+                  const Vec2        &position) const;
+
+  TTF_Font *getFont() const;
+};
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "../Helpers/Vec2.hpp"
+#include <cstddef>
+
+struct BoundingBox {
+  Vec2 min;
+  Vec2 max;
+
+  bool overlaps(const BoundingBox &other) const {
+    return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y &&
+           max.y >= other.min.y;
+  }
+};
+
+// Indices into the entity list a broadphase was built from. Each unordered pair is reported
+// once; the caller decides in which order(s) to run the narrowphase.
+struct CandidatePair {
+  size_t indexA;
+  size_t indexB;
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "../Configuration/Config.hpp"
+#include "../EntityManagement/EntityManager.hpp"
+#include "./BoundingBox.hpp"
+#include "./SpatialHashGrid.hpp"
+#include "./SweepAndPrune.hpp"
+#include <optional>
+#include <vector>
+
+/**
+ * @brief Spatial index of the moving entities, using the strategy selected at runtime.
+ *
+ * `update` indexes a list of entities, and the index then answers both candidate pair and
+ * box queries about that list until the next update. All strategies report each unordered
+ * pair once, sorted by entity index, and skip pairs whose collision filters never interact.
+ * The brute force strategy does no spatial filtering and serves as the reference for
+ * comparing the others.
+ */
+class Broadphase {
+  BroadphaseType                          m_type;
+  BroadphaseType                          m_indexType;
+  SpatialHashGrid                         m_spatialHashGrid;
+  SweepAndPrune                           m_sweepAndPrune;
+  std::vector<CandidatePair>              m_bruteForcePairs;
+  std::vector<CCollisionFilter>           m_bruteForceFilters;
+  std::vector<std::optional<BoundingBox>> m_bruteForceBoxes;
+  std::vector<size_t>                     m_queryIndices;
+
+public:
+  explicit Broadphase(BroadphaseType type = BroadphaseType::SpatialHash);
+
+  BroadphaseType getType() const;
+  void           setType(BroadphaseType type);
+  void           cycleType();
+
+  // Indexes `entities` where they are now. Switching strategies takes effect here.
+  void update(EntitySpan entities);
+
+  // Pairs of entities from the last update, by their position in its list
+  const std::vector<CandidatePair> &findCandidatePairs();
+
+  /**
+   * @brief Appends the entities whose boxes overlap `box` to `results`, in list order.
+   *
+   * `entities` must be the list the last `update` was given, and the boxes are as of that
+   * update.
+   */
+  void query(const BoundingBox &box, EntitySpan entities, EntityVector &results);
+
+  static const char *getTypeName(BroadphaseType type);
+};
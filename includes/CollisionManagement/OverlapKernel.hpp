@@ -0,0 +1,60 @@
+#pragma once
+
+#include "../EntityManagement/EntityManager.hpp"
+#include "../Helpers/Vec2.hpp"
+#include "./BoundingBox.hpp"
+#include <span>
+#include <vector>
+
+/**
+ * @brief Batched narrowphase overlap test of one entity against a list of candidates.
+ *
+ * Centers and half extents are packed into float arrays once per frame. Each query gathers
+ * its candidates into contiguous lanes, padded to a multiple of `LANE_COUNT`, and computes
+ * `halfA + halfB - |centerA - centerB|` for all of them, which is the overlap vector
+ * `CollisionHelpers::calculateOverlap` returns. The kernel uses SSE2 where it is available
+ * and a scalar loop elsewhere, such as Emscripten builds.
+ *
+ * The packed boxes do not follow the entities. After moving an entity, call `update` before
+ * computing overlaps with it again. Entities without a transform or shape never overlap
+ * anything.
+ */
+class OverlapKernel {
+  std::vector<float> m_centerX;
+  std::vector<float> m_centerY;
+  std::vector<float> m_halfWidth;
+  std::vector<float> m_halfHeight;
+
+  std::vector<float> m_laneCenterX;
+  std::vector<float> m_laneCenterY;
+  std::vector<float> m_laneHalfWidth;
+  std::vector<float> m_laneHalfHeight;
+  std::vector<float> m_laneOverlapX;
+  std::vector<float> m_laneOverlapY;
+
+  void pack(size_t index, const Entity &entity);
+  void computeLanes(size_t index, size_t laneCount);
+
+public:
+  static constexpr size_t LANE_COUNT = 4;
+
+  OverlapKernel() = default;
+
+  void load(EntitySpan entities);
+
+  // Packs the current box of an entity that moved since it was loaded
+  void update(size_t index, const Entity &entity);
+
+  /**
+   * @brief Computes the overlap between entity `index` and the `indexB` entity of each pair.
+   *
+   * Results stay valid until the next call and are read with `getOverlap`, in the order of
+   * `pairs`.
+   */
+  void computeOverlaps(size_t index, std::span<const CandidatePair> pairs);
+
+  Vec2 getOverlap(size_t candidate) const;
+
+  // Overlap of a single pair from the packed boxes, without touching the batch results
+  Vec2 computeOverlap(size_t indexA, size_t indexB) const;
+};
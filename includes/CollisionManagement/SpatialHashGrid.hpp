@@ -0,0 +1,36 @@
+#pragma once
+
+#include "../EntityManagement/EntityManager.hpp"
+#include "./BoundingBox.hpp"
+#include <SDL2/SDL.h>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Uniform grid broadphase keyed by hashed cell coordinates.
+ *
+ * The grid is rebuilt from the entity list every frame. Cells still occupied keep their
+ * vectors, so their capacity is reused from one frame to the next, and cells left empty are
+ * erased. Pairs whose collision filters never interact are dropped before they are reported.
+ */
+class SpatialHashGrid {
+  float                                           m_cellSize;
+  std::unordered_map<Uint64, std::vector<size_t>> m_cells;
+  std::vector<BoundingBox>                        m_boxes;
+  std::vector<CCollisionFilter>                   m_filters;
+  std::vector<CandidatePair>                      m_pairs;
+
+  Sint32        toCell(float coordinate) const;
+  static Uint64 hashCell(Sint32 cellX, Sint32 cellY);
+
+public:
+  static constexpr float DEFAULT_CELL_SIZE = 64.0f;
+
+  explicit SpatialHashGrid(float cellSize = DEFAULT_CELL_SIZE);
+
+  void                              rebuild(EntitySpan entities);
+  const std::vector<CandidatePair> &findCandidatePairs();
+
+  // Appends the indices of the entities whose boxes overlap `box`, each once
+  void query(const BoundingBox &box, std::vector<size_t> &results) const;
+};
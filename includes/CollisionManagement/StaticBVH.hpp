@@ -0,0 +1,43 @@
+#pragma once
+
+#include "../EntityManagement/EntityManager.hpp"
+#include "./BoundingBox.hpp"
+#include <vector>
+
+/**
+ * @brief Bounding volume hierarchy over entities that never move, such as walls.
+ *
+ * The tree is built top-down by splitting each node at the median center along its longest
+ * axis, and stored as a flat vector in depth-first order. It only holds a snapshot of the
+ * entities' boxes, so it must be rebuilt whenever the static geometry changes.
+ */
+class StaticBVH {
+  struct Node {
+    BoundingBox box;
+    size_t      first = 0; // Leaves: first item. Inner nodes: unused.
+    size_t      count = 0; // Leaves: number of items. Inner nodes: 0.
+    size_t      right = 0; // Inner nodes: right child. The left child directly follows.
+  };
+
+  struct Item {
+    Entity      entity;
+    BoundingBox box;
+  };
+
+  std::vector<Node> m_nodes;
+  std::vector<Item> m_items;
+
+  size_t buildNode(size_t first, size_t count);
+
+public:
+  static constexpr size_t LEAF_SIZE = 2;
+
+  StaticBVH() = default;
+
+  void build(EntitySpan entities);
+  void clear();
+  bool empty() const;
+
+  // Appends every entity whose box overlaps `box` to `results`
+  void query(const BoundingBox &box, EntityVector &results) const;
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "../EntityManagement/EntityManager.hpp"
+#include "./BoundingBox.hpp"
+#include <vector>
+
+/**
+ * @brief Sweep-and-prune broadphase over bounding boxes sorted by their left edge.
+ *
+ * The sorted list persists between frames. Entities move little from one frame to the next,
+ * so the list is nearly sorted already and an insertion sort restores it in close to linear
+ * time.
+ */
+class SweepAndPrune {
+  struct Proxy {
+    EntityHandle     handle;
+    size_t           index;
+    BoundingBox      box;
+    CCollisionFilter filter;
+  };
+
+  // Where the entity in each slot sat in the list given to the update numbered `update`.
+  // Slots are reused, so a proxy only belongs to the listed entity if the handles match.
+  struct SlotEntry {
+    EntityHandle handle;
+    size_t       index  = 0;
+    size_t       update = 0;
+  };
+
+  std::vector<Proxy>         m_proxies;
+  std::vector<SlotEntry>     m_slots;
+  size_t                     m_updateCount = 0;
+  std::vector<bool>          m_tracked;
+  std::vector<CandidatePair> m_pairs;
+
+  void sortProxies();
+
+public:
+  SweepAndPrune() = default;
+
+  void                              update(EntitySpan entities);
+  const std::vector<CandidatePair> &findCandidatePairs();
+
+  // Appends the indices of the entities whose boxes overlap `box`, in ascending order
+  void query(const BoundingBox &box, std::vector<size_t> &results) const;
+};
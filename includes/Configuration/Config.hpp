@@ -15,50 +15,87 @@ public:
       height(height), width(width), color(color) {}
 };
 
+enum class BroadphaseType { BruteForce, SpatialHash, SweepAndPrune };
+
+// Collision layers as bitfields. An entity sits on the layers in `category` and only reacts
+// to entities whose category shares a bit with its `mask`.
+struct CollisionFilterConfig {
+  Uint32 category = 0;
+  Uint32 mask     = 0;
+};
+
 struct GameConfig {
   Vec2                  windowSize;
   std::string           windowTitle;
   std::filesystem::path fontPath;
-  Uint64                spawnInterval = 0;
+  Uint64                spawnInterval    = 0;
+  BroadphaseType        broadphase       = BroadphaseType::SpatialHash;
+  Uint32                tickRate         = 60;
+  Uint32                maxStepsPerFrame = 5;
+  bool                  vsync            = true;
+  Uint32                fpsCap           = 0; // 0 leaves the frame rate unlimited
+  bool                  idleStaticScenes = true;
+  Uint32                headlessSeed     = 0; // Headless runs repeat exactly from this seed
 };
 
 struct PlayerConfig {
-  float       baseSpeed            = 0;
-  float       speedBoostMultiplier = 0;
-  float       slownessMultiplier   = 0;
-  ShapeConfig shape;
+  float                 baseSpeed            = 0;
+  float                 speedBoostMultiplier = 0;
+  float                 slownessMultiplier   = 0;
+  ShapeConfig           shape;
+  CollisionFilterConfig collision;
 };
 
 struct ItemConfig {
-  Uint8       spawnPercentage = 0;
-  Uint64      lifespan        = 0;
-  float       speed           = 0;
-  ShapeConfig shape;
+  Uint8                 spawnPercentage = 0;
+  Uint64                lifespan        = 0;
+  float                 speed           = 0;
+  ShapeConfig           shape;
+  CollisionFilterConfig collision;
 };
 
 struct EnemyConfig {
-  Uint8       spawnPercentage = 0;
-  Uint64      lifespan        = 0;
-  float       speed           = 0;
-  ShapeConfig shape;
+  Uint8                 spawnPercentage = 0;
+  Uint64                lifespan        = 0;
+  float                 speed           = 0;
+  ShapeConfig           shape;
+  CollisionFilterConfig collision;
 };
 
 struct SpeedEffectConfig {
-  Uint8       spawnPercentage = 0;
-  Uint64      lifespan        = 0;
-  float       speed           = 0;
-  ShapeConfig shape;
+  Uint8                 spawnPercentage = 0;
+  Uint64                lifespan        = 0;
+  float                 speed           = 0;
+  ShapeConfig           shape;
+  CollisionFilterConfig collision;
 };
 
 struct SlownessEffectConfig {
-  Uint8       spawnPercentage = 0;
-  Uint64      lifespan        = 0;
-  float       speed           = 0;
-  ShapeConfig shape;
+  Uint8                 spawnPercentage = 0;
+  Uint64                lifespan        = 0;
+  float                 speed           = 0;
+  ShapeConfig           shape;
+  CollisionFilterConfig collision;
 };
 
 struct BulletConfig {
-  Uint64      lifespan = 0;
-  float       speed    = 0;
-  ShapeConfig shape;
+  Uint64                lifespan = 0;
+  float                 speed    = 0;
+  ShapeConfig           shape;
+  CollisionFilterConfig collision;
+};
+
+struct WallConfig {
+  CollisionFilterConfig collision;
+};
+
+// Benchmark runs split their entity count between types by these percentages
+struct BenchmarkConfig {
+  Uint32                seed             = 0;
+  Uint64                ticks            = 0;
+  Uint8                 enemyPercentage  = 0;
+  Uint8                 bulletPercentage = 0;
+  Uint8                 itemPercentage   = 0;
+  Uint8                 effectPercentage = 0;
+  std::filesystem::path outputPath;
 };
\ No newline at end of file
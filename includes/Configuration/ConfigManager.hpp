@@ -23,6 +23,8 @@ private:
   ItemConfig            m_itemConfig;
   SpeedEffectConfig     m_speedEffectConfig;
   SlownessEffectConfig  m_slownessEffectConfig;
+  WallConfig            m_wallConfig;
+  BenchmarkConfig       m_benchmarkConfig;
   json                  m_json;
   std::filesystem::path m_configPath;
 
@@ -30,6 +32,20 @@ private:
   static JsonReturnType
   getJsonValue(const json &jsonValue, const std::string &key, const std::string &context);
 
+  // Like getJsonValue, but returns `fallback` when `key` is missing
+  template <typename JsonReturnType>
+  static JsonReturnType getOptionalJsonValue(const json           &jsonValue,
+                                             const std::string    &key,
+                                             const JsonReturnType &fallback,
+                                             const std::string    &context);
+
+  static BroadphaseType parseBroadphaseType(const std::string &name,
+                                            const std::string &context);
+
+  static Uint32 parseCollisionLayers(const json &layersJson, const std::string &context);
+  static CollisionFilterConfig parseCollisionFilterConfig(const json        &filterJson,
+                                                          const std::string &context);
+
   static SDL_Color   parseColor(const json &colorJson, const std::string &context);
   static ShapeConfig parseShapeConfig(const json &shapeJson, const std::string &context);
   void               parseGameConfig();
@@ -39,6 +55,8 @@ private:
   void               parseSpeedEffectConfig();
   void               parseSlownessEffectConfig();
   void               parseBulletConfig();
+  void               parseWallConfig();
+  void               parseBenchmarkConfig();
   void               parseConfig();
   void               loadConfig();
 
@@ -52,6 +70,8 @@ public:
   const BulletConfig         &getBulletConfig() const;
   const SpeedEffectConfig    &getSpeedEffectConfig() const;
   const SlownessEffectConfig &getSlownessEffectConfig() const;
+  const WallConfig           &getWallConfig() const;
+  const BenchmarkConfig      &getBenchmarkConfig() const;
 
   void updatePlayerShape(const ShapeConfig &shape);
   void updatePlayerSpeed(float speed);
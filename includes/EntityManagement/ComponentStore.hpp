@@ -0,0 +1,131 @@
+#pragma once
+
+#include <bitset>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+template <typename ComponentType, typename... ComponentTypes> struct ComponentIndex;
+
+template <typename ComponentType, typename... Rest>
+struct ComponentIndex<ComponentType, ComponentType, Rest...>
+    : std::integral_constant<size_t, 0> {};
+
+template <typename ComponentType, typename Other, typename... Rest>
+struct ComponentIndex<ComponentType, Other, Rest...>
+    : std::integral_constant<size_t, 1 + ComponentIndex<ComponentType, Rest...>::value> {};
+
+/**
+ * @brief Structure-of-arrays component storage indexed by entity slot.
+ *
+ * Every component type lives in its own contiguous vector, and slot `n` of each vector
+ * belongs to the same entity. A per-slot bitmask records which components are present.
+ * Slots of destroyed entities are recycled through a free list, so the arrays only grow to
+ * the peak number of live entities.
+ *
+ * Pointers returned by `get` stay valid until the next call to `allocateSlot`, which may
+ * grow the arrays.
+ */
+template <typename... ComponentTypes> class ComponentStore {
+public:
+  static constexpr size_t COMPONENT_COUNT = sizeof...(ComponentTypes);
+  typedef std::bitset<COMPONENT_COUNT> ComponentMask;
+
+private:
+  std::tuple<std::vector<ComponentTypes>...> m_components;
+  std::vector<ComponentMask>                 m_masks;
+  std::vector<size_t>                        m_freeSlots;
+
+public:
+  ComponentStore() = default;
+
+  size_t               allocateSlot();
+  void                 releaseSlot(size_t slot);
+  const ComponentMask &getMask(size_t slot) const;
+  bool                 matches(size_t slot, const ComponentMask &signature) const;
+
+  template <typename ComponentType> static constexpr size_t indexOf();
+  template <typename... Required> static ComponentMask signatureOf();
+
+  template <typename ComponentType> ComponentType *get(size_t slot);
+  template <typename ComponentType> void set(size_t slot, const ComponentType &value);
+  template <typename ComponentType> void remove(size_t slot);
+  template <typename ComponentType> bool has(size_t slot) const;
+};
+
+template <typename... ComponentTypes>
+size_t ComponentStore<ComponentTypes...>::allocateSlot() {
+  if (!m_freeSlots.empty()) {
+    const size_t slot = m_freeSlots.back();
+    m_freeSlots.pop_back();
+    return slot;
+  }
+
+  (std::get<std::vector<ComponentTypes>>(m_components).emplace_back(), ...);
+  m_masks.emplace_back();
+  return m_masks.size() - 1;
+}
+
+template <typename... ComponentTypes>
+void ComponentStore<ComponentTypes...>::releaseSlot(const size_t slot) {
+  // Reset every component so released slots do not hold on to resources such as effect lists.
+  ((std::get<std::vector<ComponentTypes>>(m_components)[slot] = ComponentTypes()), ...);
+  m_masks[slot].reset();
+  m_freeSlots.push_back(slot);
+}
+
+template <typename... ComponentTypes>
+const typename ComponentStore<ComponentTypes...>::ComponentMask &
+ComponentStore<ComponentTypes...>::getMask(const size_t slot) const {
+  return m_masks[slot];
+}
+
+template <typename... ComponentTypes>
+bool ComponentStore<ComponentTypes...>::matches(const size_t         slot,
+                                                const ComponentMask &signature) const {
+  return (m_masks[slot] & signature) == signature;
+}
+
+template <typename... ComponentTypes>
+template <typename ComponentType>
+constexpr size_t ComponentStore<ComponentTypes...>::indexOf() {
+  return ComponentIndex<ComponentType, ComponentTypes...>::value;
+}
+
+template <typename... ComponentTypes>
+template <typename... Required>
+typename ComponentStore<ComponentTypes...>::ComponentMask
+ComponentStore<ComponentTypes...>::signatureOf() {
+  ComponentMask signature;
+  (signature.set(indexOf<Required>()), ...);
+  return signature;
+}
+
+template <typename... ComponentTypes>
+template <typename ComponentType>
+ComponentType *ComponentStore<ComponentTypes...>::get(const size_t slot) {
+  if (!m_masks[slot].test(indexOf<ComponentType>())) {
+    return nullptr;
+  }
+  return &std::get<std::vector<ComponentType>>(m_components)[slot];
+}
+
+template <typename... ComponentTypes>
+template <typename ComponentType>
+void ComponentStore<ComponentTypes...>::set(const size_t slot, const ComponentType &value) {
+  std::get<std::vector<ComponentType>>(m_components)[slot] = value;
+  m_masks[slot].set(indexOf<ComponentType>());
+}
+
+template <typename... ComponentTypes>
+template <typename ComponentType>
+void ComponentStore<ComponentTypes...>::remove(const size_t slot) {
+  std::get<std::vector<ComponentType>>(m_components)[slot] = ComponentType();
+  m_masks[slot].reset(indexOf<ComponentType>());
+}
+
+template <typename... ComponentTypes>
+template <typename ComponentType>
+bool ComponentStore<ComponentTypes...>::has(const size_t slot) const {
+  return m_masks[slot].test(indexOf<ComponentType>());
+}
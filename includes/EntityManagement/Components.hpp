@@ -4,15 +4,25 @@
 #include <vector>
 
 #include "../Configuration/Config.hpp"
+#include "../GameEngine/GameClock.hpp"
 #include "../Helpers/Vec2.hpp"
 
 class CTransform {
 public:
   Vec2 topLeftCornerPos = {0, 0};
   Vec2 velocity         = {0, 0};
+  // Where the entity was before the latest simulation step. Collision sweeps fast movers
+  // from here, and rendering interpolates between the two positions.
+  Vec2 previousTopLeftCornerPos = {0, 0};
 
   CTransform(const Vec2 &position, const Vec2 &velocity) :
-      topLeftCornerPos(position), velocity(velocity) {}
+      topLeftCornerPos(position), velocity(velocity), previousTopLeftCornerPos(position) {}
+
+  // Moves without sweeping or interpolating from the old position
+  void teleport(const Vec2 &position) {
+    topLeftCornerPos         = position;
+    previousTopLeftCornerPos = position;
+  }
 
   CTransform() = default;
 };
@@ -24,6 +34,9 @@ public:
   SDL_Rect  rect;
   SDL_Color color;
 
+  CShape() :
+      renderer(nullptr), rect(), color() {}
+
   CShape(SDL_Renderer *renderer, const ShapeConfig &config) :
       renderer(renderer), rect(), color() {
 
@@ -36,9 +49,6 @@ public:
     rect.h = static_cast<int>(config.height);
     rect.w = static_cast<int>(config.width);
     color  = config.color;
-
-    SDL_SetRenderDrawColor(renderer, config.color.r, config.color.g, config.color.b, 255);
-    SDL_RenderFillRect(renderer, &rect);
   }
 };
 
@@ -52,15 +62,35 @@ public:
   CInput() = default;
 };
 
+// Moves the entity along CTransform's velocity every step, scaled by `speed`
+class CLinearMovement {
+public:
+  float speed = 0;
+
+  CLinearMovement() = default;
+  explicit CLinearMovement(const float speed) :
+      speed(speed) {}
+};
+
+// Drifts the entity in a slow circle every step, ignoring its velocity
+class CDriftMovement {
+public:
+  float speed = 0;
+
+  CDriftMovement() = default;
+  explicit CDriftMovement(const float speed) :
+      speed(speed) {}
+};
+
 class CLifespan {
 public:
   Uint64 birthTime;
   Uint64 lifespan = 0;
 
   CLifespan() :
-      birthTime(SDL_GetTicks64()) {}
+      birthTime(GameClock::getTicks()) {}
   explicit CLifespan(const Uint64 lifespan) :
-      birthTime(SDL_GetTicks64()), lifespan(lifespan) {}
+      birthTime(GameClock::getTicks()), lifespan(lifespan) {}
 };
 
 enum EffectTypes { Speed, Slowness };
@@ -121,3 +151,28 @@ public:
     return m_bounces;
   }
 };
+
+class CCollisionFilter {
+public:
+  // An entity without a filter sits on every layer and reacts to every layer
+  Uint32 category = ~0u;
+  Uint32 mask     = ~0u;
+
+  CCollisionFilter() = default;
+  explicit CCollisionFilter(const CollisionFilterConfig &config) :
+      category(config.category), mask(config.mask) {}
+
+  bool reactsTo(const CCollisionFilter &other) const {
+    return (mask & other.category) != 0;
+  }
+};
+
+class CSprite {
+public:
+  // Region of the scene's SpriteAtlas drawn in place of a flat rect, tinted by CShape's color
+  size_t region = 0;
+
+  CSprite() = default;
+  explicit CSprite(const size_t region) :
+      region(region) {}
+};
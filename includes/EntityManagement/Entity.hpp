@@ -1,59 +1,89 @@
 #pragma once
 
+#include "./ComponentStore.hpp"
 #include "./Components.hpp"
-#include <memory>
+#include <cstdint>
 #include <string>
 
 enum EntityTags { Player, Wall, SpeedBoost, SlownessDebuff, Enemy, Bullet, Item, Default };
 
-typedef std::tuple<std::shared_ptr<CTransform>,
-                   std::shared_ptr<CShape>,
-                   std::shared_ptr<CInput>,
-                   std::shared_ptr<CLifespan>,
-                   std::shared_ptr<CEffects>,
-                   std::shared_ptr<CBounceTracker>>
+// Default is the last tag, so every tag is a valid index below this count.
+constexpr size_t ENTITY_TAG_COUNT = EntityTags::Default + 1;
+
+// Name shown for a tag in debug output such as the profiler overlay
+constexpr const char *getTagName(const EntityTags tag) {
+  switch (tag) {
+    case EntityTags::Player:
+      return "player";
+    case EntityTags::Wall:
+      return "wall";
+    case EntityTags::SpeedBoost:
+      return "speedBoost";
+    case EntityTags::SlownessDebuff:
+      return "slownessDebuff";
+    case EntityTags::Enemy:
+      return "enemy";
+    case EntityTags::Bullet:
+      return "bullet";
+    case EntityTags::Item:
+      return "item";
+    case EntityTags::Default:
+      return "default";
+  }
+  return "unknown";
+}
+
+typedef ComponentStore<CTransform, CShape, CInput, CLinearMovement, CDriftMovement, CLifespan,
+                       CEffects, CBounceTracker, CCollisionFilter, CSprite>
     EntityComponents;
 
+class EntityManager;
+
+/**
+ * @brief Identifies an entity slot in an EntityManager.
+ *
+ * The generation is bumped every time the slot is released, so a handle to a removed entity
+ * never resolves to whichever entity reuses the slot later.
+ */
+struct EntityHandle {
+  uint32_t index      = 0;
+  uint32_t generation = 0;
+
+  bool operator==(const EntityHandle &other) const = default;
+};
+
+/**
+ * @brief Lightweight, copyable reference to an entity owned by an EntityManager.
+ *
+ * All entity state lives in the manager; an Entity only holds the manager and a generational
+ * handle. Once the entity has been removed, the reference is invalid: `isActive` returns
+ * false and `getComponent` returns nullptr.
+ */
 class Entity {
 private:
   friend class EntityManager;
-  bool       m_active = true;
-  size_t     m_id     = 0;
-  EntityTags m_tag    = Default;
+  EntityManager *m_manager = nullptr;
+  EntityHandle   m_handle;
 
-  EntityComponents m_components;
-
-  Entity(size_t id, EntityTags tag);
+  Entity(EntityManager *manager, EntityHandle handle);
 
 public:
-  // private member access functions
-  bool       isActive() const;
-  EntityTags tag() const;
-  size_t     id() const;
-  void       destroy();
-  Vec2       getCenterPos() const;
-
-  template <typename ComponentType> std::shared_ptr<ComponentType> getComponent() const;
-  template <typename ComponentType>
-  void setComponent(std::shared_ptr<ComponentType> component);
-  template <typename ComponentType> void removeComponent();
-  template <typename ComponentType> bool hasComponent() const;
-};
+  Entity() = default;
 
-template <typename ComponentType> std::shared_ptr<ComponentType> Entity::getComponent() const {
-  auto component = std::get<std::shared_ptr<ComponentType>>(m_components);
-  return component;
-}
+  // private member access functions
+  bool         isValid() const;
+  bool         isActive() const;
+  EntityTags   tag() const;
+  size_t       id() const;
+  EntityHandle handle() const;
+  void         destroy() const;
+  Vec2         getCenterPos() const;
 
-template <typename ComponentType>
-void Entity::setComponent(std::shared_ptr<ComponentType> component) {
-  std::get<std::shared_ptr<ComponentType>>(m_components) = component;
-}
+  template <typename ComponentType> ComponentType *getComponent() const;
+  template <typename ComponentType> void setComponent(const ComponentType &component) const;
+  template <typename ComponentType> void removeComponent() const;
+  template <typename ComponentType> bool hasComponent() const;
 
-template <typename ComponentType> void Entity::removeComponent() {
-  std::get<std::shared_ptr<ComponentType>>(m_components) = nullptr;
-}
+  bool operator==(const Entity &other) const = default;
+};
 
-template <typename ComponentType> bool Entity::hasComponent() const {
-  return std::get<std::shared_ptr<ComponentType>>(m_components) != nullptr;
-}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "./Entity.hpp"
+#include "./EntityManager.hpp"
+
+// Entity's component accessors read the manager's component store, so they are defined here,
+// where both classes are complete. Include this wherever components are accessed.
+
+template <typename ComponentType> ComponentType *Entity::getComponent() const {
+  if (!isValid()) {
+    return nullptr;
+  }
+  return m_manager->m_components.get<ComponentType>(m_handle.index);
+}
+
+template <typename ComponentType>
+void Entity::setComponent(const ComponentType &component) const {
+  if (!isValid()) {
+    return;
+  }
+  m_manager->m_components.set<ComponentType>(m_handle.index, component);
+}
+
+template <typename ComponentType> void Entity::removeComponent() const {
+  if (!isValid()) {
+    return;
+  }
+  m_manager->m_components.remove<ComponentType>(m_handle.index);
+}
+
+template <typename ComponentType> bool Entity::hasComponent() const {
+  return isValid() && m_manager->m_components.has<ComponentType>(m_handle.index);
+}
@@ -1,26 +1,156 @@
 #pragma once
 
 #include "./Entity.hpp"
-#include <map>
-#include <memory>
+#include <array>
+#include <span>
 #include <vector>
 
 // Store all entity objects in a vector.
-typedef std::vector<std::shared_ptr<Entity>> EntityVector;
+typedef std::vector<Entity> EntityVector;
 
-// Store separate vectors of Entity objects by their tag for quick retrieval.
-typedef std::map<EntityTags, EntityVector> EntityMap;
+// Read-only view of a list of entities owned by the EntityManager.
+typedef std::span<const Entity> EntitySpan;
+
+// Store separate vectors of Entity objects by their tag for quick retrieval. Tags are a small
+// dense enum, so the lists are indexed directly by tag.
+typedef std::array<EntityVector, ENTITY_TAG_COUNT> EntityTagLists;
+
+/**
+ * @brief Iterates the entities whose components include every type in `ComponentTypes`.
+ *
+ * Matching is a single bitmask test against the component store, so systems skip unrelated
+ * entities without looking up their components.
+ */
+template <typename... ComponentTypes> class EntityView {
+  const EntityVector                   &m_entities;
+  const EntityComponents               &m_components;
+  const EntityComponents::ComponentMask m_signature;
+
+public:
+  class Iterator {
+    const EntityView *m_view;
+    size_t            m_position;
+
+    void skipMismatches();
+
+  public:
+    Iterator(const EntityView *view, size_t position);
+
+    const Entity &operator*() const;
+    Iterator     &operator++();
+    bool          operator==(const Iterator &other) const;
+  };
+
+  EntityView(const EntityVector &entities, const EntityComponents &components);
+
+  Iterator begin() const;
+  Iterator end() const;
+};
 
 class EntityManager {
-  EntityVector m_entities;
-  EntityVector m_toAdd;
-  EntityMap    m_entityMap;
-  size_t       m_totalEntities = 0;
+  friend class Entity;
+
+  // Bookkeeping for one entity slot. The slot index is shared with the component store.
+  // entityIndex and tagIndex locate the entity in m_entities and in its tag list, so it can
+  // be removed from both without searching.
+  struct EntitySlot {
+    uint32_t   generation  = 0;
+    EntityTags tag         = Default;
+    bool       active      = false;
+    size_t     entityIndex = 0;
+    size_t     tagIndex    = 0;
+  };
+
+  EntityVector            m_entities;
+  EntityVector            m_toAdd;
+  EntityVector            m_toRemove;
+  EntityTagLists          m_entitiesByTag;
+  EntityComponents        m_components;
+  std::vector<EntitySlot> m_slots;
 
 public:
   EntityManager();
-  std::shared_ptr<Entity> addEntity(const EntityTags tag);
-  EntityVector           &getEntities();
-  EntityVector           &getEntities(const EntityTags tag);
-  void                    update();
+
+  // Entities point back at their manager, so the manager must stay where it was created.
+  EntityManager(const EntityManager &)            = delete;
+  EntityManager &operator=(const EntityManager &) = delete;
+
+  Entity     addEntity(const EntityTags tag);
+  Entity     getEntity(EntityHandle handle);
+  bool       isValid(EntityHandle handle) const;
+  EntitySpan getEntities() const;
+  EntitySpan getEntities(const EntityTags tag) const;
+
+  // Entities added since the last update, which getEntities does not list yet
+  EntitySpan getPendingEntities() const;
+
+  // Whether the next update has any additions or removals to apply
+  bool hasPendingChanges() const;
+
+  /**
+   * @brief Applies the additions and removals queued since the last call.
+   *
+   * Entities created by addEntity only show up in getEntities and views after this runs, and
+   * destroyed entities stay listed until then. Call it once per frame.
+   */
+  void update();
+
+  template <typename... ComponentTypes> EntityView<ComponentTypes...> view() const;
 };
+
+template <typename... ComponentTypes>
+EntityView<ComponentTypes...>::EntityView(const EntityVector     &entities,
+                                          const EntityComponents &components) :
+    m_entities(entities),
+    m_components(components),
+    m_signature(EntityComponents::signatureOf<ComponentTypes...>()) {}
+
+template <typename... ComponentTypes>
+typename EntityView<ComponentTypes...>::Iterator EntityView<ComponentTypes...>::begin() const {
+  return {this, 0};
+}
+
+template <typename... ComponentTypes>
+typename EntityView<ComponentTypes...>::Iterator EntityView<ComponentTypes...>::end() const {
+  return {this, m_entities.size()};
+}
+
+template <typename... ComponentTypes>
+EntityView<ComponentTypes...>::Iterator::Iterator(const EntityView *view,
+                                                  const size_t      position) :
+    m_view(view), m_position(position) {
+  skipMismatches();
+}
+
+template <typename... ComponentTypes>
+void EntityView<ComponentTypes...>::Iterator::skipMismatches() {
+  const EntityVector &entities = m_view->m_entities;
+  while (m_position < entities.size() &&
+         !m_view->m_components.matches(entities[m_position].handle().index,
+                                       m_view->m_signature)) {
+    m_position++;
+  }
+}
+
+template <typename... ComponentTypes>
+const Entity &EntityView<ComponentTypes...>::Iterator::operator*() const {
+  return m_view->m_entities[m_position];
+}
+
+template <typename... ComponentTypes>
+typename EntityView<ComponentTypes...>::Iterator &
+EntityView<ComponentTypes...>::Iterator::operator++() {
+  m_position++;
+  skipMismatches();
+  return *this;
+}
+
+template <typename... ComponentTypes>
+bool EntityView<ComponentTypes...>::Iterator::operator==(const Iterator &other) const {
+  return m_position == other.m_position;
+}
+
+template <typename... ComponentTypes>
+EntityView<ComponentTypes...> EntityManager::view() const {
+  return {m_entities, m_components};
+}
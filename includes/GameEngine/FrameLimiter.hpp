@@ -0,0 +1,21 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+
+/**
+ * @brief Caps the frame rate by holding each frame until its slot on a fixed schedule.
+ *
+ * Waiting sleeps for most of the remaining time and spins on the performance counter for the
+ * last stretch, because `SDL_Delay` can oversleep by a scheduler tick. A frame that runs more
+ * than a whole slot late restarts the schedule instead of rushing to catch up.
+ */
+class FrameLimiter {
+  Uint64 m_frameTicks = 0;
+  Uint64 m_nextFrame  = 0;
+
+public:
+  // A cap of 0 leaves the frame rate unlimited
+  explicit FrameLimiter(Uint32 fpsCap);
+
+  void wait();
+};
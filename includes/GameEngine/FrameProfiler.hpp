@@ -0,0 +1,51 @@
+#pragma once
+
+#include "./SystemTimer.hpp"
+#include <array>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Rolling per-frame view of the timings collected by a `SystemTimer`.
+ *
+ * Once per frame, `sampleFrame` stores how much time each system gained since the previous
+ * frame in a ring buffer of the last `FRAME_COUNT` frames. Statistics are computed from that
+ * window on demand.
+ *
+ * The engine only creates a profiler when built with `ENABLE_PROFILER`.
+ */
+class FrameProfiler {
+public:
+  static constexpr size_t FRAME_COUNT = 240;
+
+  struct Stats {
+    std::string name;
+    double      minMicroseconds     = 0;
+    double      averageMicroseconds = 0;
+    double      p99Microseconds     = 0;
+  };
+
+  FrameProfiler() = default;
+
+  void sampleFrame(const SystemTimer &systemTimer);
+
+  // One entry per system, in the order the systems first ran
+  const std::vector<Stats> &computeStats();
+
+  void toggleVisible();
+  bool isVisible() const;
+
+private:
+  struct Series {
+    std::string                     name;
+    Uint64                          lastTotalTicks = 0;
+    std::array<Uint64, FRAME_COUNT> samples        = {};
+  };
+
+  std::vector<Series> m_series;
+  std::vector<Stats>  m_stats;
+  std::vector<Uint64> m_sortedSamples;
+  size_t              m_nextFrame  = 0;
+  size_t              m_frameCount = 0;
+  bool                m_visible    = false;
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+
+/**
+ * @brief Millisecond time source for all game logic.
+ *
+ * Reads SDL's tick counter by default. Headless runs switch it to a manual clock that only
+ * moves when advanced, so the simulation can run faster than real time and repeat exactly.
+ */
+class GameClock {
+  static bool   m_manual;
+  static Uint64 m_manualTicks;
+
+public:
+  static Uint64 getTicks();
+  static void   useManualClock(Uint64 startTicks);
+  static void   advance(Uint64 milliseconds);
+};
@@ -5,6 +5,8 @@
 #include "../Configuration/ConfigManager.hpp"
 #include "../SystemManagement/AudioManager.hpp"
 #include "../SystemManagement/VideoManager.hpp"
+#include "./FrameProfiler.hpp"
+#include "./SystemTimer.hpp"
 
 #include <SDL2/SDL.h>
 #include <filesystem>
@@ -17,14 +19,23 @@ class GameEngine {
 protected:
   std::map<std::string, std::shared_ptr<Scene>> m_scenes;
   std::string                                   m_currentSceneName;
-  bool                                          m_isRunning = false;
+  bool                                          m_isRunning            = false;
+  bool                                          m_headless             = false;
+  bool                                          m_sceneLoaded          = false;
+  size_t                                        m_benchmarkEntityCount = 0;
   std::unique_ptr<ConfigManager>                m_configManager;
-  std::unique_ptr<FontManager>                  m_fontManager;
   std::unique_ptr<AudioManager>                 m_audioManager;
   std::unique_ptr<AudioSampleQueue>             m_audioSampleQueue;
   std::unique_ptr<VideoManager>                 m_videoManager;
+  std::unique_ptr<FontManager>                  m_fontManager; // Owns textures, so after video
+  SystemTimer                                   m_systemTimer;
+
+#ifdef ENABLE_PROFILER
+  FrameProfiler m_frameProfiler;
+#endif
 
   void update();
+  bool canIdle();
 
   static void mainLoop(void *arg);
   static void cleanup();
@@ -32,14 +43,19 @@ protected:
   void sUserInput();
 
   static std::unique_ptr<ConfigManager> createConfigManager(const Path &configPath);
-  static std::unique_ptr<AudioManager>  createAudioManager();
+  static std::unique_ptr<AudioManager>  createAudioManager(bool headless);
 
   std::unique_ptr<VideoManager>     createVideoManager();
   std::unique_ptr<FontManager>      createFontManager();
   std::unique_ptr<AudioSampleQueue> initializeAudioSampleQueue();
 
 public:
-  GameEngine();
+  /**
+   * @brief Starts the engine. A headless engine opens no window or audio device, runs on a
+   * manual clock and goes straight to `MainScene`, benchmarking it when
+   * `benchmarkEntityCount` is non-zero.
+   */
+  explicit GameEngine(bool headless = false, size_t benchmarkEntityCount = 0);
   ~GameEngine();
   void quit();
   bool isRunning() const;
@@ -50,6 +66,21 @@ public:
   AudioManager     &getAudioManager() const;
   AudioSampleQueue &getAudioSampleQueue() const;
   VideoManager     &getVideoManager() const;
+  SystemTimer      &getSystemTimer();
+
+#ifdef ENABLE_PROFILER
+  FrameProfiler &getFrameProfiler();
+#endif
+
+  bool isHeadless() const;
 
-  void run();
+  /**
+   * @brief Runs the main loop until quit, or for `maxFrames` frames when it is non-zero.
+   *
+   * Headless runs advance the manual clock by one tick per frame instead of waiting on it,
+   * and each frame simulates exactly one tick.
+   * Otherwise frames are held to the configured FPS cap, and static scenes wait for input
+   * between frames when idling is configured.
+   */
+  void run(Uint64 maxFrames = 0);
 };
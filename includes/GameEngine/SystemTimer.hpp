@@ -0,0 +1,48 @@
+#pragma once
+
+#include "./TraceRecorder.hpp"
+#include <SDL2/SDL.h>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Accumulates how long each named system takes, using SDL's performance counter.
+ *
+ * Timings are kept in the order the systems first ran, so reports list them in frame order.
+ * Each measurement is also recorded as a trace event when tracing is on, so `name` must be a
+ * string literal. Systems may be measured and timings read from several threads at once.
+ */
+class SystemTimer {
+public:
+  struct Timing {
+    std::string name;
+    Uint64      calls      = 0;
+    Uint64      totalTicks = 0;
+    Uint64      maxTicks   = 0;
+  };
+
+  SystemTimer() = default;
+
+  template <typename System>
+  void measure(const std::string_view name, System &&system) {
+    const TraceRecorder::Scope trace(name);
+    const Uint64               start = SDL_GetPerformanceCounter();
+    system();
+    record(name, SDL_GetPerformanceCounter() - start);
+  }
+
+  void record(std::string_view name, Uint64 ticks);
+  void clear();
+
+  // Returns a copy, so the timings can be read while other threads keep recording
+  std::vector<Timing> getTimings() const;
+
+  // Converts performance counter ticks to microseconds
+  static double toMicroseconds(Uint64 ticks);
+
+private:
+  mutable std::mutex  m_mutex;
+  std::vector<Timing> m_timings;
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Records begin/end events in Chrome's trace event JSON format.
+ *
+ * Load the output in chrome://tracing or ui.perfetto.dev. Events from any thread go into a
+ * shared buffer, and a writer thread flushes that buffer to the file in the background, so
+ * the game never waits on disk. Recording is off until `start` is called, and every call is
+ * a single atomic load while it is off.
+ *
+ * Event names are not copied, so they must outlive the recording; string literals do.
+ */
+class TraceRecorder {
+  struct Event {
+    std::string_view name;
+    char             phase;
+    Uint64           timestamp;
+    Uint32           threadId;
+  };
+
+  static std::atomic<bool>       m_enabled;
+  static std::mutex              m_mutex;
+  static std::condition_variable m_flushRequested;
+  static std::vector<Event>      m_pending;
+  static std::thread             m_writer;
+  static std::ofstream           m_output;
+  static Uint64                  m_startCounter;
+  static bool                    m_stopping;
+  static bool                    m_firstEvent;
+
+  static void   record(std::string_view name, char phase);
+  static void   writeEvents(const std::vector<Event> &events);
+  static void   runWriter();
+  static Uint32 getThreadId();
+
+public:
+  /**
+   * @brief Opens `path` and starts recording.
+   * @throws std::runtime_error If the file could not be opened.
+   */
+  static void start(const std::filesystem::path &path);
+
+  // Flushes the remaining events and closes the file
+  static void stop();
+
+  static bool isEnabled();
+  static void begin(std::string_view name);
+  static void end(std::string_view name);
+
+  // Records a begin event now and the matching end event when it goes out of scope
+  class Scope {
+    std::string_view m_name;
+
+  public:
+    explicit Scope(const std::string_view name) :
+        m_name(name) {
+      begin(m_name);
+    }
+    ~Scope() {
+      end(m_name);
+    }
+
+    Scope(const Scope &)            = delete;
+    Scope &operator=(const Scope &) = delete;
+  };
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief Runs one job at a time on a thread that lives as long as this object.
+ *
+ * `start` hands a job to the thread and returns immediately, and `wait` blocks until that
+ * job has finished, rethrowing anything it threw. Every `start` must be followed by a `wait`
+ * before the next one. Web builds have no threads, so there `start` runs the job inline.
+ */
+class WorkerThread {
+  std::mutex              m_mutex;
+  std::condition_variable m_changed;
+  std::function<void()>   m_job;
+  std::exception_ptr      m_error;
+  bool                    m_busy     = false;
+  bool                    m_stopping = false;
+  std::thread             m_thread;
+
+  void run();
+
+public:
+  WorkerThread();
+  ~WorkerThread();
+
+  WorkerThread(const WorkerThread &)            = delete;
+  WorkerThread &operator=(const WorkerThread &) = delete;
+
+  void start(std::function<void()> job);
+  void wait();
+};
@@ -1,11 +1,19 @@
 #pragma once
 
 #include "../GameEngine/GameEngine.hpp"
+#include "../Helpers/TextLabel.hpp"
+#include "../RenderManagement/CachedFrame.hpp"
 #include "./Scene.hpp"
+#include <vector>
 
 class HowToPlayScene final : public Scene {
 private:
-  void renderText() const;
+  std::vector<TextLabel> m_labels;
+  TextLabel              m_exitLabel;
+  CachedFrame            m_frame;
+
+  void createLabels();
+  void renderText();
 
 public:
   explicit HowToPlayScene(GameEngine *gameEngine);
@@ -16,5 +24,10 @@ public:
   void sDoAction(Action &action) override;
   void sAudio() override;
 
-  void onSceneWindowResize() override {};
+  void onSceneWindowResize() override;
+  void onRenderTargetsReset() override;
+
+  bool isStatic() const override {
+    return true;
+  }
 };
@@ -1,31 +1,99 @@
 #pragma once
 
 #include "../../includes/AssetManagement/AudioSampleQueue.hpp"
+#include "../CollisionManagement/Broadphase.hpp"
+#include "../CollisionManagement/OverlapKernel.hpp"
+#include "../CollisionManagement/StaticBVH.hpp"
 #include "../EntityManagement/EntityManager.hpp"
+#include "../GameEngine/WorkerThread.hpp"
 #include "../GameScenes/Scene.hpp"
+#include "../Helpers/TextLabel.hpp"
+#include "../RenderManagement/SpriteAtlas.hpp"
+#include "../RenderManagement/SpriteBatch.hpp"
 #include <SDL2/SDL.h>
+#include <array>
 #include <random>
 
 class MainScene final : public Scene {
 private:
-  Uint64                  m_lastNonPlayerEntitySpawnTime = 0;
-  Uint64                  m_lastFrameTime                = 0;
-  EntityManager           m_entities;
-  float                   m_deltaTime = 0;
-  bool                    m_paused    = false;
-  int                     m_score     = 0;
-  int                     m_lives     = 5;
-  std::shared_ptr<Entity> m_player;
-  Uint64                  m_timeRemaining = 2.5 * 60 * 1000;
-  bool                    m_gameOver      = false;
-  std::random_device      m_rd;
-  std::mt19937            m_randomGenerator     = std::mt19937(m_rd());
-  Uint64                  m_lastBulletSpawnTime = 0;
-  Uint64                  m_bulletSpawnCooldown = 90;
-  void                    renderText() const;
+  // Everything sRender draws, captured from the entities at the end of each simulation pass
+  struct RenderSnapshot {
+    SpriteBatch sprites;
+    int         score         = 0;
+    int         lives         = 0;
+    Uint64      timeRemaining = 0;
+    bool        speedBoost    = false;
+    bool        slowness      = false;
+#ifdef ENABLE_PROFILER
+    std::array<size_t, ENTITY_TAG_COUNT> tagCounts = {};
+#endif
+  };
+
+  Uint64             m_lastNonPlayerEntitySpawnTime = 0;
+  Uint64             m_lastFrameTime                = 0;
+  EntityManager      m_entities;
+  float              m_deltaTime = 0;
+  bool               m_paused    = false;
+  int                m_score     = 0;
+  int                m_lives     = 5;
+  Entity             m_player;
+  Uint64             m_timeRemaining = 2.5 * 60 * 1000;
+  bool               m_gameOver      = false;
+  std::random_device m_rd;
+  std::mt19937       m_randomGenerator     = std::mt19937(m_rd());
+  Uint64             m_lastBulletSpawnTime = 0;
+  Uint64             m_bulletSpawnCooldown = 90;
+  Broadphase         m_broadphase;
+  StaticBVH          m_wallTree;
+  EntityVector       m_movingEntities;
+  EntityVector       m_nearbyWalls;
+  EntityVector       m_visibleEntities;
+  OverlapKernel      m_overlapKernel;
+  SpriteAtlas        m_spriteAtlas;
+  size_t             m_benchmarkEntityCount     = 0;
+  Uint64             m_benchmarkTicks           = 0;
+  Uint64             m_benchmarkLiveEntityTotal = 0;
+  TextLabel          m_scoreLabel;
+  TextLabel          m_livesLabel;
+  TextLabel          m_timeLabel;
+  TextLabel          m_speedBoostLabel;
+  TextLabel          m_slownessLabel;
+  void               createLabels();
+  void               renderText(const RenderSnapshot &snapshot);
+
+  // The simulation fills the back snapshot on the worker while sRender draws the front one.
+  // The worker is declared last, so it is destroyed first and its job never outlives the
+  // state it uses.
+  std::array<RenderSnapshot, 2> m_snapshots;
+  size_t                        m_frontSnapshot = 0;
+  WorkerThread                  m_simulationThread;
+
+  // `entitiesChanged` tells whether entities were added or removed since the last pass
+  void simulate(float frameTime, bool entitiesChanged);
+  void indexMovingEntities();
+  void followPlayer();
+  void captureSnapshot(RenderSnapshot &snapshot);
+
+#ifdef ENABLE_PROFILER
+  void renderProfilerOverlay(const RenderSnapshot &snapshot) const;
+#endif
+
+  static Uint8 calculateFadedAlpha(const Entity &entity, Uint8 alpha, Uint64 currentTime);
+
+  bool isBenchmarking() const;
+  void spawnBenchmarkEntities();
+  void writeBenchmarkReport() const;
 
 public:
-  explicit MainScene(GameEngine *gameEngine);
+  /**
+   * @brief A non-zero `benchmarkEntityCount` starts a benchmark run instead of a game.
+   *
+   * The run seeds the random generator from `BenchmarkConfig`, spawns that many entities
+   * split by the configured mix, and cannot end early. Lifespans do not expire during it.
+   * After the configured number of ticks it appends each system's timings, with the mean and
+   * final live entity counts, to the benchmark CSV and quits the engine.
+   */
+  explicit MainScene(GameEngine *gameEngine, size_t benchmarkEntityCount = 0);
 
   void onSceneWindowResize() override;
 
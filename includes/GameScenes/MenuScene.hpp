@@ -1,17 +1,26 @@
 #pragma once
 #include "../GameEngine/Action.hpp"
 #include "../GameEngine/GameEngine.hpp"
+#include "../Helpers/TextLabel.hpp"
+#include "../RenderManagement/CachedFrame.hpp"
 #include "./Scene.hpp"
 #include <map>
 #include <string>
+#include <vector>
 
 class MenuScene final : public Scene {
 private:
-  void         renderText() const;
+  void         createLabels();
+  void         renderText();
   bool         m_playButtonClicked         = false;
   bool         m_instructionsButtonClicked = false;
   unsigned int m_selectedIndex             = 0;
 
+  TextLabel              m_titleLabel;
+  std::vector<TextLabel> m_optionLabels;
+  TextLabel              m_controlsLabel;
+  CachedFrame            m_frame;
+
 public:
   explicit MenuScene(GameEngine *gameEngine);
   void update() override;
@@ -19,5 +28,10 @@ public:
   void sRender() override;
   void sDoAction(Action &action) override;
   void sAudio() override;
-  void onSceneWindowResize() override {};
+  void onSceneWindowResize() override;
+  void onRenderTargetsReset() override;
+
+  bool isStatic() const override {
+    return true;
+  }
 };
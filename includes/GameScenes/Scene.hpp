@@ -1,6 +1,7 @@
 #pragma once
 #include "../GameEngine/Action.hpp"
 #include "../GameEngine/GameEngine.hpp"
+#include <cmath>
 #include <map>
 #include <string>
 
@@ -17,6 +18,35 @@ protected:
   Uint64      m_SceneStartTime = 0;
   ActionMap   m_actionMap;
 
+  // Fixed-step bookkeeping, see takeFixedSteps
+  float m_stepAccumulator = 0;
+  float m_interpolation   = 0;
+
+  /**
+   * @brief Banks `frameTime` seconds and returns how many fixed steps are now due.
+   *
+   * Leftover time carries over to the next frame, and `m_interpolation` is set to how far
+   * the frame sits between the last two steps. At most `maxSteps` are returned; time beyond
+   * that is dropped, so a slow frame cannot snowball into ever slower ones.
+   */
+  Uint32 takeFixedSteps(const float  frameTime,
+                        const float  stepDuration,
+                        const Uint32 maxSteps) {
+    m_stepAccumulator += frameTime;
+
+    auto steps = static_cast<Uint32>(m_stepAccumulator / stepDuration);
+
+    if (steps > maxSteps) {
+      steps             = maxSteps;
+      m_stepAccumulator = std::fmod(m_stepAccumulator, stepDuration);
+    } else {
+      m_stepAccumulator -= static_cast<float>(steps) * stepDuration;
+    }
+
+    m_interpolation = m_stepAccumulator / stepDuration;
+    return steps;
+  }
+
 public:
   explicit Scene(GameEngine *gameEngine) :
       m_gameEngine(gameEngine) {};
@@ -30,6 +60,14 @@ public:
 
   virtual void onSceneWindowResize() = 0;
 
+  // Target textures lost their contents, as some renderers do when the device changes
+  virtual void onRenderTargetsReset() {}
+
+  // Static scenes only change in response to input, so the engine may sleep until an event
+  virtual bool isStatic() const {
+    return false;
+  }
+
   void registerAction(const int inputKey, const std::string &actionName) {
     m_actionMap[inputKey] = actionName;
   }
@@ -2,12 +2,21 @@
 
 #include "../GameEngine/GameEngine.hpp"
 #include "../GameScenes/Scene.hpp"
+#include "../Helpers/TextLabel.hpp"
+#include "../RenderManagement/CachedFrame.hpp"
 
 class ScoreScene final : public Scene {
 private:
   unsigned int m_score;
   unsigned int m_selectedIndex = 0;
-  void         renderText() const;
+  void         createLabels();
+  void         renderText();
+
+  TextLabel   m_gameOverLabel;
+  TextLabel   m_scoreLabel;
+  TextLabel   m_playAgainLabel;
+  TextLabel   m_mainMenuLabel;
+  CachedFrame m_frame;
 
 public:
   ScoreScene(GameEngine *gameEngine, int score);
@@ -17,5 +26,10 @@ public:
   void sRender() override;
   void sDoAction(Action &action) override;
   void sAudio() override;
-  void onSceneWindowResize() override {};
+  void onSceneWindowResize() override;
+  void onRenderTargetsReset() override;
+
+  bool isStatic() const override {
+    return true;
+  }
 };
@@ -1,12 +1,15 @@
 #pragma once
 
+#include <array>
 #include <bitset>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <random>
 
 #include "../AssetManagement/AudioSampleQueue.hpp"
+#include "../CollisionManagement/BoundingBox.hpp"
 #include "../EntityManagement/Entity.hpp"
 #include "../EntityManagement/EntityManager.hpp"
 #include "../Helpers/Vec2.hpp"
@@ -14,24 +17,36 @@
 
 namespace CollisionHelpers {
 
-  std::bitset<4> detectOutOfBounds(const std::shared_ptr<Entity> &entity,
-                                   const Vec2                    &window_size);
+  std::bitset<4> detectOutOfBounds(const Entity &entity, const Vec2 &window_size);
 
-  bool calculateCollisionBetweenEntities(const std::shared_ptr<Entity> &entityA,
-                                         const std::shared_ptr<Entity> &entityB);
+  bool calculateCollisionBetweenEntities(const Entity &entityA, const Entity &entityB);
 
-  Vec2 calculateOverlap(const std::shared_ptr<Entity> &entityA,
-                        const std::shared_ptr<Entity> &entityB);
+  Vec2 calculateOverlap(const Entity &entityA, const Entity &entityB);
 
-  std::bitset<4> getPositionRelativeToEntity(const std::shared_ptr<Entity> &entityA,
-                                             const std::shared_ptr<Entity> &entityB);
+  std::bitset<4> getPositionRelativeToEntity(const Entity &entityA, const Entity &entityB);
+
+  std::optional<BoundingBox> calculateBoundingBox(const Entity &entity);
+
+  // Box covering the entity both before and after this frame's movement
+  std::optional<BoundingBox> calculateSweptBoundingBox(const Entity &entity);
+
+  // Fraction of this frame's movement after which the two entities first touch, if they do
+  std::optional<float> calculateTimeOfImpact(const Entity &entityA, const Entity &entityB);
+
+  CCollisionFilter getCollisionFilter(const Entity &entity);
+
+  // A pair is worth testing when either entity reacts to the other
+  bool canInteract(const CCollisionFilter &filterA, const CCollisionFilter &filterB);
 
 } // namespace CollisionHelpers
 
 namespace CollisionHelpers::MainScene {
   struct CollisionPair {
-    const std::shared_ptr<Entity> &entityA;
-    const std::shared_ptr<Entity> &entityB;
+    Entity entityA;
+    Entity entityB;
+    // How far the two boxes overlap on each axis, as calculateOverlap measures it. Callers
+    // that already have it, such as the overlap kernel, pass it along instead of recomputing.
+    Vec2 overlap;
   };
 
   struct GameState {
@@ -44,23 +59,50 @@ namespace CollisionHelpers::MainScene {
     const Vec2                      windowSize;
   };
 
-  void handleEntityBounds(const std::shared_ptr<Entity> &entity, const Vec2 &windowSize);
-  void handleEntityEntityCollision(const CollisionPair &collisionPair, const GameState &args);
+  // Resolves a colliding pair. The first entity's tag selects the response, the second
+  // entity is what it ran into.
+  typedef void (*CollisionResponse)(const CollisionPair &collisionPair, const GameState &args);
+  typedef std::array<std::array<CollisionResponse, ENTITY_TAG_COUNT>, ENTITY_TAG_COUNT>
+      CollisionResponseTable;
 
-} // namespace CollisionHelpers::MainScene
-
-namespace CollisionHelpers::MainScene::Enforce {
-  void enforcePlayerBounds(const std::shared_ptr<Entity> &entity,
-                           const std::bitset<4>          &collides,
-                           const Vec2                    &window_size);
+  CollisionResponse getCollisionResponse(EntityTags tag, EntityTags otherTag);
 
-  void enforceNonPlayerBounds(const std::shared_ptr<Entity> &entity,
-                              const std::bitset<4>          &collides);
+  // Entities whose whole path this frame is checked, not only where they ended up
+  bool usesContinuousCollision(const Entity &entity);
 
-  void enforceCollisionWithWall(const std::shared_ptr<Entity> &entity,
-                                const std::shared_ptr<Entity> &wall);
+  void handleEntityBounds(const Entity &entity, const Vec2 &windowSize);
+  // Returns whether a response ran, since responses may move either entity
+  bool handleEntityEntityCollision(const CollisionPair &collisionPair, const GameState &args);
 
-  void enforceEntityEntityCollision(const std::shared_ptr<Entity> &entityA,
-                                    const std::shared_ptr<Entity> &entityB);
+} // namespace CollisionHelpers::MainScene
 
-} // namespace CollisionHelpers::MainScene::Enforce
\ No newline at end of file
+namespace CollisionHelpers::MainScene::Enforce {
+  void enforcePlayerBounds(const Entity         &entity,
+                           const std::bitset<4> &collides,
+                           const Vec2           &window_size);
+
+  void enforceNonPlayerBounds(const Entity &entity, const std::bitset<4> &collides);
+
+  void enforceCollisionWithWall(const Entity &entity,
+                                const Entity &wall,
+                                const Vec2   &overlap);
+
+  void enforceEntityEntityCollision(const Entity &entityA,
+                                    const Entity &entityB,
+                                    const Vec2   &overlap);
+
+  bool enforceContinuousCollision(const Entity &entity, const Entity &otherEntity);
+
+} // namespace CollisionHelpers::MainScene::Enforce
+
+namespace CollisionHelpers::MainScene::Respond {
+  void bounceOffWall(const CollisionPair &collisionPair, const GameState &args);
+  void pushApart(const CollisionPair &collisionPair, const GameState &args);
+  void bulletHitsWall(const CollisionPair &collisionPair, const GameState &args);
+  void bulletHitsEnemy(const CollisionPair &collisionPair, const GameState &args);
+  void bulletHitsPickup(const CollisionPair &collisionPair, const GameState &args);
+  void playerHitsEnemy(const CollisionPair &collisionPair, const GameState &args);
+  void playerCollectsSlowness(const CollisionPair &collisionPair, const GameState &args);
+  void playerCollectsSpeedBoost(const CollisionPair &collisionPair, const GameState &args);
+  void playerCollectsItem(const CollisionPair &collisionPair, const GameState &args);
+} // namespace CollisionHelpers::MainScene::Respond
\ No newline at end of file
@@ -8,11 +8,11 @@
 #include <vector>
 
 namespace EntityHelpers {
-  EntityVector findClosestEntities(const std::shared_ptr<Entity> &entity,
-                                   const EntityVector            &candidates,
-                                   const size_t                  &limit);
+  EntityVector findClosestEntities(const Entity &entity,
+                                   EntitySpan    candidates,
+                                   const size_t &limit);
 
-  EntityVector getEntitiesInRadius(const std::shared_ptr<Entity> &entity,
-                                   const EntityVector            &candidates,
-                                   const float                   &radius);
+  EntityVector getEntitiesInRadius(const Entity &entity,
+                                   EntitySpan    candidates,
+                                   const float  &radius);
 } // namespace EntityHelpers
@@ -8,21 +8,13 @@
 #include <memory>
 
 namespace MovementHelpers {
-  void moveEnemies(const std::shared_ptr<Entity> &entity,
-                   const EnemyConfig             &enemyConfig,
-                   const float                   &deltaTime);
-  void moveSpeedBoosts(const std::shared_ptr<Entity> &entity,
-                       const SpeedEffectConfig       &speedBoostEffectConfig,
-                       const float                   &deltaTime);
-  void movePlayer(const std::shared_ptr<Entity> &entity,
-                  const PlayerConfig            &playerConfig,
-                  const float                   &deltaTime);
+  void movePlayer(const Entity       &entity,
+                  const PlayerConfig &playerConfig,
+                  const float        &deltaTime);
 
-  void moveSlownessDebuffs(const std::shared_ptr<Entity> &entity,
-                           const SlownessEffectConfig    &slownessEffectConfig,
-                           const float                   &deltaTime);
+  // Moves an entity with a CLinearMovement along its velocity
+  void moveLinear(const Entity &entity, const float &deltaTime);
 
-  void moveBullets(const std::shared_ptr<Entity> &entity, const float &deltaTime);
-
-  void moveItems(const std::shared_ptr<Entity> &entity, const float &deltaTime);
+  // Moves an entity with a CDriftMovement in a circle, phased by the parity of its id
+  void moveDrifting(const Entity &entity, const float &deltaTime);
 } // namespace MovementHelpers
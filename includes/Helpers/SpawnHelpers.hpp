@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../CollisionManagement/StaticBVH.hpp"
 #include "../Configuration/ConfigManager.hpp"
 #include "../EntityManagement/Entity.hpp"
 #include "../EntityManagement/EntityManager.hpp"
@@ -13,47 +14,56 @@
 namespace SpawnHelpers {
   Vec2 createRandomPosition(std::mt19937 &randomGenerator, const Vec2 &windowSize);
   Vec2 createValidVelocity(std::mt19937 &randomGenerator, int attempts = 5);
-  bool validateSpawnPosition(const std::shared_ptr<Entity> &entity,
-                             const std::shared_ptr<Entity> &player,
-                             EntityManager                 &entityManager,
-                             const Vec2                    &windowSize);
+  bool validateSpawnPosition(const Entity  &entity,
+                             const Entity  &player,
+                             EntityManager &entityManager,
+                             const Vec2    &windowSize);
 } // namespace SpawnHelpers
 namespace SpawnHelpers::MainScene {
-  std::shared_ptr<Entity> spawnPlayer(SDL_Renderer        *renderer,
-                                      const ConfigManager &configManager,
-                                      EntityManager       &entityManager);
-
-  void spawnEnemy(SDL_Renderer                  *renderer,
-                  const ConfigManager           &configManager,
-                  std::mt19937                  &randomGenerator,
-                  EntityManager                 &entityManager,
-                  const std::shared_ptr<Entity> &player);
-
-  void spawnSpeedBoostEntity(SDL_Renderer                  *renderer,
-                             const ConfigManager           &configManager,
-                             std::mt19937                  &randomGenerator,
-                             EntityManager                 &entityManager,
-                             const std::shared_ptr<Entity> &player);
-
-  void spawnSlownessEntity(SDL_Renderer                  *renderer,
-                           const ConfigManager           &configManager,
-                           std::mt19937                  &randomGenerator,
-                           EntityManager                 &entityManager,
-                           const std::shared_ptr<Entity> &player);
+  Entity spawnPlayer(SDL_Renderer        *renderer,
+                     const ConfigManager &configManager,
+                     EntityManager       &entityManager);
 
+  // The random spawners retry until `validateSpawnPosition` accepts a position, and give up
+  // after a few attempts. Without `checkPosition`, the first random position is kept.
+  void spawnEnemy(SDL_Renderer        *renderer,
+                  const ConfigManager &configManager,
+                  std::mt19937        &randomGenerator,
+                  EntityManager       &entityManager,
+                  const Entity        &player,
+                  bool                 checkPosition = true);
+
+  void spawnSpeedBoostEntity(SDL_Renderer        *renderer,
+                             const ConfigManager &configManager,
+                             std::mt19937        &randomGenerator,
+                             EntityManager       &entityManager,
+                             const Entity        &player,
+                             bool                 checkPosition = true);
+
+  void spawnSlownessEntity(SDL_Renderer        *renderer,
+                           const ConfigManager &configManager,
+                           std::mt19937        &randomGenerator,
+                           EntityManager       &entityManager,
+                           const Entity        &player,
+                           bool                 checkPosition = true);
+
+  // Also rebuilds `wallTree` from the new walls
   void spawnWalls(SDL_Renderer        *renderer,
                   const ConfigManager &configManager,
-                  EntityManager       &entityManager);
-
-  void spawnBullets(SDL_Renderer                  *renderer,
-                    const ConfigManager           &configManager,
-                    EntityManager                 &entityManager,
-                    const std::shared_ptr<Entity> &player,
-                    const Vec2                    &mousePosition);
-
-  void spawnItem(SDL_Renderer                  *renderer,
-                 const ConfigManager           &configManager,
-                 std::mt19937                  &randomGenerator,
-                 EntityManager                 &entityManager,
-                 const std::shared_ptr<Entity> &player);
+                  EntityManager       &entityManager,
+                  StaticBVH           &wallTree);
+
+  void spawnBullets(SDL_Renderer        *renderer,
+                    const ConfigManager &configManager,
+                    EntityManager       &entityManager,
+                    const StaticBVH     &wallTree,
+                    const Entity        &player,
+                    const Vec2          &mousePosition);
+
+  void spawnItem(SDL_Renderer        *renderer,
+                 const ConfigManager &configManager,
+                 std::mt19937        &randomGenerator,
+                 EntityManager       &entityManager,
+                 const Entity        &player,
+                 bool                 checkPosition = true);
 } // namespace SpawnHelpers::MainScene
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../AssetManagement/GlyphAtlas.hpp"
 #include "./Vec2.hpp"
 #include <SDL2/SDL.h>
 #include <SDL_ttf.h>
@@ -7,7 +8,7 @@
 
 namespace TextHelpers {
   void renderLineOfText(SDL_Renderer      *renderer,
-                        TTF_Font          *font,
+                        const GlyphAtlas  *font,
                         const std::string &text,
                         const SDL_Color   &color,
                         const Vec2        &position);
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "../AssetManagement/GlyphAtlas.hpp"
+#include "./Vec2.hpp"
+#include <SDL2/SDL.h>
+#include <string>
+
+/**
+ * @brief A line of text that keeps its rasterized texture between frames.
+ *
+ * The text is only rasterized again when `setText` actually changes it. Color and position
+ * are applied when drawing, so changing them never rasterizes. Use it for text that changes
+ * rarely or not at all, and `TextHelpers::renderLineOfText` for text that changes every
+ * frame.
+ */
+class TextLabel {
+  const GlyphAtlas *m_font = nullptr;
+  std::string       m_text;
+  SDL_Color         m_color    = {.r = 255, .g = 255, .b = 255, .a = 255};
+  Vec2              m_position = {0, 0};
+  SDL_Texture      *m_texture  = nullptr;
+  int               m_width    = 0;
+  int               m_height   = 0;
+  bool              m_dirty    = true;
+
+  void rasterize(SDL_Renderer *renderer);
+  void destroyTexture();
+
+public:
+  TextLabel() = default;
+  TextLabel(const GlyphAtlas *font,
+            std::string       text,
+            const SDL_Color  &color,
+            const Vec2       &position);
+  ~TextLabel();
+
+  TextLabel(TextLabel &&other) noexcept;
+  TextLabel &operator=(TextLabel &&other) noexcept;
+  TextLabel(const TextLabel &)            = delete;
+  TextLabel &operator=(const TextLabel &) = delete;
+
+  void setText(const std::string &text);
+  void setColor(const SDL_Color &color);
+  void setPosition(const Vec2 &position);
+
+  void render(SDL_Renderer *renderer);
+};
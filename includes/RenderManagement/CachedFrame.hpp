@@ -0,0 +1,45 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+
+/**
+ * @brief Keeps a finished frame in a target texture, so frames that show nothing new are a
+ * single copy.
+ *
+ * Call `invalidate` whenever what the frame shows changes. The frame is also drawn again when
+ * the renderer's output size changes. Renderers without target textures draw every frame.
+ */
+class CachedFrame {
+  SDL_Texture *m_texture = nullptr;
+  int          m_width   = 0;
+  int          m_height  = 0;
+  bool         m_dirty   = true;
+
+  bool needsRedraw(SDL_Renderer *renderer) const;
+  bool beginRedraw(SDL_Renderer *renderer);
+  void endRedraw(SDL_Renderer *renderer);
+
+public:
+  CachedFrame() = default;
+  ~CachedFrame();
+
+  CachedFrame(const CachedFrame &)            = delete;
+  CachedFrame &operator=(const CachedFrame &) = delete;
+
+  void invalidate();
+
+  // Runs `draw` into the cache only when it is out of date, then copies the cache to the
+  // current render target
+  template <typename Draw> void render(SDL_Renderer *renderer, Draw &&draw) {
+    if (needsRedraw(renderer)) {
+      if (!beginRedraw(renderer)) {
+        draw();
+        return;
+      }
+      draw();
+      endRedraw(renderer);
+    }
+
+    SDL_RenderCopy(renderer, m_texture, nullptr, nullptr);
+  }
+};
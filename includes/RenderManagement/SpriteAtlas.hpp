@@ -0,0 +1,44 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+/**
+ * @brief Packs every image the scene draws into one texture at load time.
+ *
+ * Images are added before `build` and referred to by the region index `addImage` returns.
+ * Region `SOLID_REGION` is a white block that flat-colored shapes sample, so they share the
+ * texture with sprites and can be drawn in the same `SDL_RenderGeometry` call. Regions are
+ * stored as normalized texture coordinates, with a transparent border between images so
+ * filtering never samples a neighbour.
+ */
+class SpriteAtlas {
+  SDL_Texture               *m_texture = nullptr;
+  std::vector<SDL_Surface *> m_images;
+  std::vector<SDL_FRect>     m_regions;
+
+  void freeImages();
+
+public:
+  static constexpr size_t SOLID_REGION = 0;
+
+  SpriteAtlas();
+  ~SpriteAtlas();
+
+  SpriteAtlas(const SpriteAtlas &)            = delete;
+  SpriteAtlas &operator=(const SpriteAtlas &) = delete;
+
+  /**
+   * @brief Copies `image` into the atlas. The caller keeps ownership of `image`.
+   * @throws std::runtime_error If the atlas is already built or the image can't be copied.
+   */
+  size_t addImage(const SDL_Surface *image);
+
+  /**
+   * @throws std::runtime_error If the atlas surface or texture could not be created.
+   */
+  void build(SDL_Renderer *renderer);
+
+  SDL_Texture     *getTexture() const;
+  const SDL_FRect &getRegion(size_t region) const;
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+/**
+ * @brief Collects textured quads from one atlas and draws them with one call.
+ *
+ * Every quad carries its color in its vertices, so tinting and fading sprites never changes
+ * texture state. Quads are drawn in the order they were added. Vertex and index storage is
+ * kept across frames, so batching a frame allocates nothing once it has grown to fit.
+ */
+class SpriteBatch {
+  std::vector<SDL_Vertex> m_vertices;
+  std::vector<int>        m_indices;
+
+public:
+  SpriteBatch() = default;
+
+  // Empties the batch but keeps its memory for the next frame
+  void clear();
+
+  // `source` is in normalized texture coordinates, as returned by `SpriteAtlas::getRegion`
+  void add(const SDL_FRect &destination, const SDL_FRect &source, const SDL_Color &color);
+
+  // Issues a single SDL_RenderGeometry call for every quad in the batch
+  void submit(SDL_Renderer *renderer, SDL_Texture *texture) const;
+};
@@ -73,7 +73,8 @@ public:
   explicit AudioManager(int    frequency = 44100,
                         Uint16 format    = MIX_DEFAULT_FORMAT,
                         int    channels  = 2,
-                        int    chunksize = 2048);
+                        int    chunksize = 2048,
+                        bool   headless  = false);
 
   static constexpr size_t MAX_SAMPLES_PER_FRAME = 4;
   static constexpr int    DEFAULT_SAMPLE_VOLUME = MIX_MAX_VOLUME / MAX_SAMPLES_PER_FRAME;
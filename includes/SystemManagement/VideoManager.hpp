@@ -1,4 +1,5 @@
 #pragma once
+#include "../CollisionManagement/BoundingBox.hpp"
 #include "../Configuration/ConfigManager.hpp"
 #include "../Helpers/Vec2.hpp"
 #include <SDL2/SDL.h>
@@ -7,23 +8,36 @@ class VideoManager {
 private:
   SDL_Renderer *m_renderer = nullptr;
   SDL_Window   *m_window   = nullptr;
+  SDL_Surface  *m_surface  = nullptr;
+  bool          m_headless = false;
 
   Vec2           m_currentWindowSize;
+  Vec2           m_cameraPosition = {0, 0};
   ConfigManager &m_configManager;
 
   static void   initializeVideoSystem();
   void          setupRenderer() const;
   SDL_Renderer *createRenderer() const;
   SDL_Window   *createWindow();
+  SDL_Renderer *createHeadlessRenderer();
   Vec2          getWindowSize() const;
 
 public:
-  explicit VideoManager(ConfigManager &configManager);
+  /**
+   * @brief Opens the game window, or a windowless software renderer when `headless` is set.
+   */
+  explicit VideoManager(ConfigManager &configManager, bool headless = false);
 
   ~VideoManager();
 
   void updateWindowSize();
 
+  // World position shown at the window's top-left corner
+  const Vec2 &getCameraPosition() const;
+  void        setCameraPosition(const Vec2 &position);
+  // World area the window currently shows
+  BoundingBox getCameraBounds() const;
+
   SDL_Renderer *getRenderer() const;
   SDL_Window   *getWindow() const;
   void          cleanup();
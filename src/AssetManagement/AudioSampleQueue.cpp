@@ -1,4 +1,6 @@
 #include "../../includes/AssetManagement/AudioSampleQueue.hpp"
+#include "../../includes/GameEngine/GameClock.hpp"
+#include "../../includes/GameEngine/TraceRecorder.hpp"
 
 AudioSampleQueue::AudioSampleQueue(AudioManager &audioManager) :
     m_audioManager(audioManager),
@@ -11,7 +13,7 @@ AudioSampleQueue::AudioSampleQueue(AudioManager &audioManager) :
 
 void AudioSampleQueue::queueSample(const AudioSample         sample,
                                    const AudioSamplePriority priority) {
-  const Uint64 currentTime = SDL_GetTicks64();
+  const Uint64 currentTime = GameClock::getTicks();
 
   if (m_lastPlayTimes.contains(sample)) {
     const Uint64 lastPlayTime      = m_lastPlayTimes.find(sample)->second;
@@ -25,7 +27,9 @@ void AudioSampleQueue::queueSample(const AudioSample         sample,
 }
 
 void AudioSampleQueue::update() {
-  const Uint64     currentTime           = SDL_GetTicks64();
+  const TraceRecorder::Scope trace("AudioSampleQueue::update");
+
+  const Uint64     currentTime           = GameClock::getTicks();
   size_t           soundsPlayedThisFrame = 0;
   constexpr size_t MAX_SOUNDS_PER_FRAME  = AudioManager::MAX_SAMPLES_PER_FRAME;
 
@@ -1,6 +1,6 @@
 #include "../../includes/AssetManagement/FontManager.hpp"
 
-FontManager::FontManager(const Path &fontPath) :
+FontManager::FontManager(const Path &fontPath, SDL_Renderer *renderer) :
     m_fontPath(fontPath) {
   if (TTF_Init() != 0) {
     SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Failed to initialize SDL_ttf: %s", TTF_GetError());
@@ -9,6 +9,7 @@ FontManager::FontManager(const Path &fontPath) :
 
   SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "SDL_ttf initialized successfully.");
   loadFonts(fontPath);
+  buildGlyphAtlases(renderer);
 }
 
 void FontManager::loadFonts(const Path &fontPath) {
@@ -31,6 +32,22 @@ void FontManager::loadFonts(const Path &fontPath) {
   SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Fonts loaded successfully!");
 }
 
+void FontManager::buildGlyphAtlases(SDL_Renderer *renderer) {
+  const bool fontsLoaded =
+      m_font_lg != nullptr && m_font_md != nullptr && m_font_sm != nullptr;
+
+  if (!fontsLoaded) {
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Cannot build glyph atlases without fonts");
+    return;
+  }
+
+  m_atlas_lg = std::make_unique<GlyphAtlas>(renderer, m_font_lg);
+  m_atlas_md = std::make_unique<GlyphAtlas>(renderer, m_font_md);
+  m_atlas_sm = std::make_unique<GlyphAtlas>(renderer, m_font_sm);
+
+  SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Glyph atlases built successfully!");
+}
+
 TTF_Font *FontManager::getFontLg() const {
   return m_font_lg;
 }
@@ -43,9 +60,25 @@ TTF_Font *FontManager::getFontSm() const {
   return m_font_sm;
 }
 
+const GlyphAtlas *FontManager::getGlyphAtlasLg() const {
+  return m_atlas_lg.get();
+}
+
+const GlyphAtlas *FontManager::getGlyphAtlasMd() const {
+  return m_atlas_md.get();
+}
+
+const GlyphAtlas *FontManager::getGlyphAtlasSm() const {
+  return m_atlas_sm.get();
+}
+
 FontManager::~FontManager() {
   SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Cleaning up fonts...");
 
+  m_atlas_lg.reset();
+  m_atlas_md.reset();
+  m_atlas_sm.reset();
+
   if (m_font_md != nullptr) {
     TTF_CloseFont(m_font_md);
     m_font_md = nullptr;
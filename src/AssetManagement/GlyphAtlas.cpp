@@ -0,0 +1,135 @@
+#include "../../includes/AssetManagement/GlyphAtlas.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+GlyphAtlas::GlyphAtlas(SDL_Renderer *renderer, TTF_Font *font) :
+    m_font(font) {
+  constexpr int       MAX_ATLAS_WIDTH = 1024;
+  constexpr SDL_Color glyphColor      = {.r = 255, .g = 255, .b = 255, .a = 255};
+
+  // Rasterize every glyph first, so the atlas can be sized to fit them
+  std::vector<SDL_Surface *> glyphSurfaces;
+  glyphSurfaces.reserve(m_glyphs.size());
+
+  auto freeGlyphSurfaces = [&glyphSurfaces]() -> void {
+    for (SDL_Surface *surface : glyphSurfaces) {
+      SDL_FreeSurface(surface);
+    }
+  };
+
+  int penX        = 0;
+  int penY        = 0;
+  int rowHeight   = 0;
+  int atlasHeight = 0;
+
+  for (size_t index = 0; index < m_glyphs.size(); index++) {
+    const auto   character = static_cast<Uint16>(FIRST_GLYPH + index);
+    SDL_Surface *surface   = TTF_RenderGlyph_Solid(m_font, character, glyphColor);
+
+    if (surface == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Failed to render glyph %d: %s", character,
+                   TTF_GetError());
+      freeGlyphSurfaces();
+      throw std::runtime_error("Failed to render glyph");
+    }
+    glyphSurfaces.push_back(surface);
+
+    if (penX + surface->w > MAX_ATLAS_WIDTH) {
+      penX = 0;
+      penY += rowHeight;
+      rowHeight = 0;
+    }
+
+    Glyph &glyph = m_glyphs[index];
+    glyph.source = {.x = penX, .y = penY, .w = surface->w, .h = surface->h};
+    TTF_GlyphMetrics(m_font, character, nullptr, nullptr, nullptr, nullptr, &glyph.advance);
+
+    penX += surface->w;
+    rowHeight   = std::max(rowHeight, surface->h);
+    atlasHeight = std::max(atlasHeight, penY + rowHeight);
+  }
+
+  m_kerning.resize(GLYPH_COUNT * GLYPH_COUNT);
+  for (size_t previous = 0; previous < GLYPH_COUNT; previous++) {
+    for (size_t current = 0; current < GLYPH_COUNT; current++) {
+      m_kerning[previous * GLYPH_COUNT + current] = TTF_GetFontKerningSizeGlyphs(
+          m_font, static_cast<Uint16>(FIRST_GLYPH + previous),
+          static_cast<Uint16>(FIRST_GLYPH + current));
+    }
+  }
+
+  SDL_Surface *atlasSurface = SDL_CreateRGBSurfaceWithFormat(
+      0, MAX_ATLAS_WIDTH, atlasHeight, 32, SDL_PIXELFORMAT_RGBA32);
+
+  if (atlasSurface == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Failed to create glyph atlas surface: %s",
+                 SDL_GetError());
+    freeGlyphSurfaces();
+    throw std::runtime_error("Failed to create glyph atlas surface");
+  }
+
+  // Pixels no glyph covers stay fully transparent
+  SDL_FillRect(atlasSurface, nullptr, SDL_MapRGBA(atlasSurface->format, 0, 0, 0, 0));
+  for (size_t index = 0; index < glyphSurfaces.size(); index++) {
+    SDL_Rect destination = m_glyphs[index].source;
+    SDL_BlitSurface(glyphSurfaces[index], nullptr, atlasSurface, &destination);
+  }
+  freeGlyphSurfaces();
+
+  m_texture = SDL_CreateTextureFromSurface(renderer, atlasSurface);
+  SDL_FreeSurface(atlasSurface);
+
+  if (m_texture == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Failed to create glyph atlas texture: %s",
+                 SDL_GetError());
+    throw std::runtime_error("Failed to create glyph atlas texture");
+  }
+
+  SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_BLEND);
+}
+
+GlyphAtlas::~GlyphAtlas() {
+  if (m_texture != nullptr) {
+    SDL_DestroyTexture(m_texture);
+    m_texture = nullptr;
+  }
+}
+
+size_t GlyphAtlas::getGlyphIndex(const char character) {
+  if (character < FIRST_GLYPH || character > LAST_GLYPH) {
+    return '?' - FIRST_GLYPH;
+  }
+  return character - FIRST_GLYPH;
+}
+
+void GlyphAtlas::renderText(SDL_Renderer      *renderer,
+                            const std::string &text,
+                            const SDL_Color   &color,
+                            const Vec2        &position) const {
+  SDL_SetTextureColorMod(m_texture, color.r, color.g, color.b);
+  SDL_SetTextureAlphaMod(m_texture, color.a);
+
+  const int penY = static_cast<int>(position.y);
+  int       penX = static_cast<int>(position.x);
+
+  for (size_t character = 0; character < text.size(); character++) {
+    const size_t index = getGlyphIndex(text[character]);
+    const Glyph &glyph = m_glyphs[index];
+
+    if (character > 0) {
+      penX += m_kerning[getGlyphIndex(text[character - 1]) * GLYPH_COUNT + index];
+    }
+
+    const SDL_Rect destination = {
+        .x = penX, .y = penY, .w = glyph.source.w, .h = glyph.source.h};
+    SDL_RenderCopy(renderer, m_texture, &glyph.source, &destination);
+
+    penX += glyph.advance;
+  }
+}
+
+TTF_Font *GlyphAtlas::getFont() const {
+  return m_font;
+}
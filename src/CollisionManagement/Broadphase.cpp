@@ -0,0 +1,113 @@
+#include "../../includes/CollisionManagement/Broadphase.hpp"
+#include "../../includes/Helpers/CollisionHelpers.hpp"
+
+Broadphase::Broadphase(const BroadphaseType type) :
+    m_type(type), m_indexType(type) {}
+
+BroadphaseType Broadphase::getType() const {
+  return m_type;
+}
+
+void Broadphase::setType(const BroadphaseType type) {
+  m_type = type;
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Broadphase set to %s", getTypeName(type));
+}
+
+void Broadphase::cycleType() {
+  switch (m_type) {
+    case BroadphaseType::BruteForce:
+      setType(BroadphaseType::SpatialHash);
+      break;
+    case BroadphaseType::SpatialHash:
+      setType(BroadphaseType::SweepAndPrune);
+      break;
+    case BroadphaseType::SweepAndPrune:
+      setType(BroadphaseType::BruteForce);
+      break;
+  }
+}
+
+void Broadphase::update(EntitySpan entities) {
+  m_indexType = m_type;
+
+  switch (m_indexType) {
+    case BroadphaseType::SpatialHash:
+      m_spatialHashGrid.rebuild(entities);
+      return;
+    case BroadphaseType::SweepAndPrune:
+      m_sweepAndPrune.update(entities);
+      return;
+    case BroadphaseType::BruteForce:
+      break;
+  }
+
+  m_bruteForceFilters.clear();
+  m_bruteForceBoxes.clear();
+  for (const Entity &entity : entities) {
+    m_bruteForceFilters.push_back(CollisionHelpers::getCollisionFilter(entity));
+    m_bruteForceBoxes.push_back(CollisionHelpers::calculateSweptBoundingBox(entity));
+  }
+}
+
+const std::vector<CandidatePair> &Broadphase::findCandidatePairs() {
+  // The type may have changed since the last update, so use the index that was built
+  switch (m_indexType) {
+    case BroadphaseType::SpatialHash:
+      return m_spatialHashGrid.findCandidatePairs();
+    case BroadphaseType::SweepAndPrune:
+      return m_sweepAndPrune.findCandidatePairs();
+    case BroadphaseType::BruteForce:
+      break;
+  }
+
+  m_bruteForcePairs.clear();
+  for (size_t indexA = 0; indexA < m_bruteForceFilters.size(); indexA++) {
+    for (size_t indexB = indexA + 1; indexB < m_bruteForceFilters.size(); indexB++) {
+      if (!CollisionHelpers::canInteract(m_bruteForceFilters[indexA],
+                                         m_bruteForceFilters[indexB])) {
+        continue;
+      }
+      m_bruteForcePairs.push_back({.indexA = indexA, .indexB = indexB});
+    }
+  }
+
+  return m_bruteForcePairs;
+}
+
+void Broadphase::query(const BoundingBox &box, EntitySpan entities, EntityVector &results) {
+  m_queryIndices.clear();
+
+  switch (m_indexType) {
+    case BroadphaseType::SpatialHash:
+      m_spatialHashGrid.query(box, m_queryIndices);
+      break;
+    case BroadphaseType::SweepAndPrune:
+      m_sweepAndPrune.query(box, m_queryIndices);
+      break;
+    case BroadphaseType::BruteForce:
+      // No index, so every box is tested
+      for (size_t index = 0; index < m_bruteForceBoxes.size(); index++) {
+        const std::optional<BoundingBox> &entityBox = m_bruteForceBoxes[index];
+        if (entityBox.has_value() && entityBox->overlaps(box)) {
+          m_queryIndices.push_back(index);
+        }
+      }
+      break;
+  }
+
+  for (const size_t index : m_queryIndices) {
+    results.push_back(entities[index]);
+  }
+}
+
+const char *Broadphase::getTypeName(const BroadphaseType type) {
+  switch (type) {
+    case BroadphaseType::BruteForce:
+      return "brute force";
+    case BroadphaseType::SpatialHash:
+      return "spatial hash grid";
+    case BroadphaseType::SweepAndPrune:
+      return "sweep and prune";
+  }
+  return "unknown";
+}
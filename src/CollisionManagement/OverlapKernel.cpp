@@ -0,0 +1,124 @@
+#include "../../includes/CollisionManagement/OverlapKernel.hpp"
+#include "../../includes/Helpers/CollisionHelpers.hpp"
+
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+void OverlapKernel::load(EntitySpan entities) {
+  m_centerX.resize(entities.size());
+  m_centerY.resize(entities.size());
+  m_halfWidth.resize(entities.size());
+  m_halfHeight.resize(entities.size());
+
+  for (size_t index = 0; index < entities.size(); index++) {
+    pack(index, entities[index]);
+  }
+}
+
+void OverlapKernel::update(const size_t index, const Entity &entity) {
+  pack(index, entity);
+}
+
+void OverlapKernel::pack(const size_t index, const Entity &entity) {
+  const std::optional<BoundingBox> box = CollisionHelpers::calculateBoundingBox(entity);
+
+  // Infinitely negative extents make every overlap with this entity negative
+  if (!box.has_value()) {
+    m_centerX[index]    = 0;
+    m_centerY[index]    = 0;
+    m_halfWidth[index]  = -std::numeric_limits<float>::infinity();
+    m_halfHeight[index] = -std::numeric_limits<float>::infinity();
+    return;
+  }
+
+  m_halfWidth[index]  = (box->max.x - box->min.x) / 2.0f;
+  m_halfHeight[index] = (box->max.y - box->min.y) / 2.0f;
+  m_centerX[index]    = box->min.x + m_halfWidth[index];
+  m_centerY[index]    = box->min.y + m_halfHeight[index];
+}
+
+void OverlapKernel::computeOverlaps(const size_t index, std::span<const CandidatePair> pairs) {
+  const size_t laneCount = (pairs.size() + LANE_COUNT - 1) / LANE_COUNT * LANE_COUNT;
+
+  m_laneCenterX.resize(laneCount);
+  m_laneCenterY.resize(laneCount);
+  m_laneHalfWidth.resize(laneCount);
+  m_laneHalfHeight.resize(laneCount);
+  m_laneOverlapX.resize(laneCount);
+  m_laneOverlapY.resize(laneCount);
+
+  for (size_t lane = 0; lane < pairs.size(); lane++) {
+    const size_t candidate = pairs[lane].indexB;
+
+    m_laneCenterX[lane]    = m_centerX[candidate];
+    m_laneCenterY[lane]    = m_centerY[candidate];
+    m_laneHalfWidth[lane]  = m_halfWidth[candidate];
+    m_laneHalfHeight[lane] = m_halfHeight[candidate];
+  }
+
+  // Padding lanes only keep the kernel to whole batches; their results are never read
+  for (size_t lane = pairs.size(); lane < laneCount; lane++) {
+    m_laneCenterX[lane]    = m_centerX[index];
+    m_laneCenterY[lane]    = m_centerY[index];
+    m_laneHalfWidth[lane]  = 0;
+    m_laneHalfHeight[lane] = 0;
+  }
+
+  computeLanes(index, laneCount);
+}
+
+void OverlapKernel::computeLanes(const size_t index, const size_t laneCount) {
+#if defined(__SSE2__)
+  const __m128 centerX    = _mm_set1_ps(m_centerX[index]);
+  const __m128 centerY    = _mm_set1_ps(m_centerY[index]);
+  const __m128 halfWidth  = _mm_set1_ps(m_halfWidth[index]);
+  const __m128 halfHeight = _mm_set1_ps(m_halfHeight[index]);
+
+  // Clearing the sign bit gives the absolute value
+  const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+  for (size_t lane = 0; lane < laneCount; lane += LANE_COUNT) {
+    const __m128 otherCenterX    = _mm_loadu_ps(&m_laneCenterX[lane]);
+    const __m128 otherCenterY    = _mm_loadu_ps(&m_laneCenterY[lane]);
+    const __m128 otherHalfWidth  = _mm_loadu_ps(&m_laneHalfWidth[lane]);
+    const __m128 otherHalfHeight = _mm_loadu_ps(&m_laneHalfHeight[lane]);
+
+    const __m128 deltaX = _mm_and_ps(_mm_sub_ps(centerX, otherCenterX), absMask);
+    const __m128 deltaY = _mm_and_ps(_mm_sub_ps(centerY, otherCenterY), absMask);
+
+    _mm_storeu_ps(&m_laneOverlapX[lane],
+                  _mm_sub_ps(_mm_add_ps(halfWidth, otherHalfWidth), deltaX));
+    _mm_storeu_ps(&m_laneOverlapY[lane],
+                  _mm_sub_ps(_mm_add_ps(halfHeight, otherHalfHeight), deltaY));
+  }
+#else
+  const float centerX    = m_centerX[index];
+  const float centerY    = m_centerY[index];
+  const float halfWidth  = m_halfWidth[index];
+  const float halfHeight = m_halfHeight[index];
+
+  for (size_t lane = 0; lane < laneCount; lane++) {
+    const float deltaX = std::abs(centerX - m_laneCenterX[lane]);
+    const float deltaY = std::abs(centerY - m_laneCenterY[lane]);
+
+    m_laneOverlapX[lane] = halfWidth + m_laneHalfWidth[lane] - deltaX;
+    m_laneOverlapY[lane] = halfHeight + m_laneHalfHeight[lane] - deltaY;
+  }
+#endif
+}
+
+Vec2 OverlapKernel::getOverlap(const size_t candidate) const {
+  return {m_laneOverlapX[candidate], m_laneOverlapY[candidate]};
+}
+
+Vec2 OverlapKernel::computeOverlap(const size_t indexA, const size_t indexB) const {
+  const float deltaX = std::abs(m_centerX[indexA] - m_centerX[indexB]);
+  const float deltaY = std::abs(m_centerY[indexA] - m_centerY[indexB]);
+
+  return {m_halfWidth[indexA] + m_halfWidth[indexB] - deltaX,
+          m_halfHeight[indexA] + m_halfHeight[indexB] - deltaY};
+}
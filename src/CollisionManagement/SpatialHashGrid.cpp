@@ -0,0 +1,112 @@
+#include "../../includes/CollisionManagement/SpatialHashGrid.hpp"
+#include "../../includes/Helpers/CollisionHelpers.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <ranges>
+
+SpatialHashGrid::SpatialHashGrid(const float cellSize) :
+    m_cellSize(cellSize) {}
+
+Sint32 SpatialHashGrid::toCell(const float coordinate) const {
+  return static_cast<Sint32>(std::floor(coordinate / m_cellSize));
+}
+
+Uint64 SpatialHashGrid::hashCell(const Sint32 cellX, const Sint32 cellY) {
+  return static_cast<Uint64>(static_cast<Uint32>(cellX)) << 32 | static_cast<Uint32>(cellY);
+}
+
+void SpatialHashGrid::rebuild(EntitySpan entities) {
+  for (std::vector<size_t> &cell : m_cells | std::views::values) {
+    cell.clear();
+  }
+
+  m_boxes.resize(entities.size());
+  m_filters.resize(entities.size());
+
+  for (size_t index = 0; index < entities.size(); index++) {
+    const std::optional<BoundingBox> box =
+        CollisionHelpers::calculateSweptBoundingBox(entities[index]);
+    if (!box.has_value()) {
+      continue;
+    }
+
+    m_boxes[index]   = *box;
+    m_filters[index] = CollisionHelpers::getCollisionFilter(entities[index]);
+
+    const Sint32 minCellX = toCell(box->min.x);
+    const Sint32 maxCellX = toCell(box->max.x);
+    const Sint32 minCellY = toCell(box->min.y);
+    const Sint32 maxCellY = toCell(box->max.y);
+
+    for (Sint32 cellY = minCellY; cellY <= maxCellY; cellY++) {
+      for (Sint32 cellX = minCellX; cellX <= maxCellX; cellX++) {
+        m_cells[hashCell(cellX, cellY)].push_back(index);
+      }
+    }
+  }
+
+  // Cells nothing touches any more are dropped, so the map stays the size of the area the
+  // entities cover and the pair search never walks empty cells
+  std::erase_if(m_cells, [](const auto &cell) -> bool { return cell.second.empty(); });
+}
+
+const std::vector<CandidatePair> &SpatialHashGrid::findCandidatePairs() {
+  m_pairs.clear();
+
+  for (const auto &[cellKey, cell] : m_cells) {
+    for (size_t i = 0; i < cell.size(); i++) {
+      const BoundingBox &boxA = m_boxes[cell[i]];
+
+      for (size_t j = i + 1; j < cell.size(); j++) {
+        const BoundingBox &boxB = m_boxes[cell[j]];
+        if (!CollisionHelpers::canInteract(m_filters[cell[i]], m_filters[cell[j]]) ||
+            !boxA.overlaps(boxB)) {
+          continue;
+        }
+
+        // A pair sharing several cells is only reported by the cell holding the top-left
+        // corner of the overlap region, so no pair is emitted twice.
+        const Sint32 ownerCellX = toCell(std::max(boxA.min.x, boxB.min.x));
+        const Sint32 ownerCellY = toCell(std::max(boxA.min.y, boxB.min.y));
+        if (hashCell(ownerCellX, ownerCellY) != cellKey) {
+          continue;
+        }
+
+        m_pairs.push_back({.indexA = cell[i], .indexB = cell[j]});
+      }
+    }
+  }
+
+  // Cells are visited in hash order; sort so pairs are resolved in entity order, as the
+  // nested loop this replaces did.
+  std::ranges::sort(m_pairs, [](const CandidatePair &a, const CandidatePair &b) {
+    return a.indexA != b.indexA ? a.indexA < b.indexA : a.indexB < b.indexB;
+  });
+
+  return m_pairs;
+}
+
+void SpatialHashGrid::query(const BoundingBox &box, std::vector<size_t> &results) const {
+  const size_t first = results.size();
+
+  for (Sint32 cellY = toCell(box.min.y); cellY <= toCell(box.max.y); cellY++) {
+    for (Sint32 cellX = toCell(box.min.x); cellX <= toCell(box.max.x); cellX++) {
+      const auto cell = m_cells.find(hashCell(cellX, cellY));
+      if (cell == m_cells.end()) {
+        continue;
+      }
+
+      for (const size_t index : cell->second) {
+        if (m_boxes[index].overlaps(box)) {
+          results.push_back(index);
+        }
+      }
+    }
+  }
+
+  // Entities spanning several cells are found once per cell
+  const auto begin = results.begin() + static_cast<std::ptrdiff_t>(first);
+  std::sort(begin, results.end());
+  results.erase(std::unique(begin, results.end()), results.end());
+}
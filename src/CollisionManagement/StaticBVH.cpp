@@ -0,0 +1,107 @@
+#include "../../includes/CollisionManagement/StaticBVH.hpp"
+#include "../../includes/Helpers/CollisionHelpers.hpp"
+
+#include <algorithm>
+#include <array>
+
+void StaticBVH::build(EntitySpan entities) {
+  clear();
+
+  for (const Entity &entity : entities) {
+    const std::optional<BoundingBox> box = CollisionHelpers::calculateBoundingBox(entity);
+    if (!box.has_value()) {
+      continue;
+    }
+    m_items.push_back({.entity = entity, .box = *box});
+  }
+
+  if (m_items.empty()) {
+    return;
+  }
+
+  // A binary tree with at least one item per leaf never has more than 2n - 1 nodes
+  m_nodes.reserve(2 * m_items.size() - 1);
+  buildNode(0, m_items.size());
+}
+
+size_t StaticBVH::buildNode(const size_t first, const size_t count) {
+  const size_t nodeIndex = m_nodes.size();
+  m_nodes.emplace_back();
+
+  BoundingBox box = m_items[first].box;
+  for (size_t index = first + 1; index < first + count; index++) {
+    const BoundingBox &itemBox = m_items[index].box;
+
+    box.min.x = std::min(box.min.x, itemBox.min.x);
+    box.min.y = std::min(box.min.y, itemBox.min.y);
+    box.max.x = std::max(box.max.x, itemBox.max.x);
+    box.max.y = std::max(box.max.y, itemBox.max.y);
+  }
+  m_nodes[nodeIndex].box = box;
+
+  if (count <= LEAF_SIZE) {
+    m_nodes[nodeIndex].first = first;
+    m_nodes[nodeIndex].count = count;
+    return nodeIndex;
+  }
+
+  // Split at the median center along the longest axis, so both halves get half the items
+  const bool splitOnX = box.max.x - box.min.x >= box.max.y - box.min.y;
+  auto       center   = [splitOnX](const Item &item) -> float {
+    return splitOnX ? item.box.min.x + item.box.max.x : item.box.min.y + item.box.max.y;
+  };
+
+  const auto begin = m_items.begin() + static_cast<std::ptrdiff_t>(first);
+  const auto end   = begin + static_cast<std::ptrdiff_t>(count);
+  const auto half  = count / 2;
+  std::nth_element(begin, begin + static_cast<std::ptrdiff_t>(half), end,
+                   [&center](const Item &a, const Item &b) -> bool {
+                     return center(a) < center(b);
+                   });
+
+  buildNode(first, half);
+  const size_t right       = buildNode(first + half, count - half);
+  m_nodes[nodeIndex].right = right;
+  return nodeIndex;
+}
+
+void StaticBVH::clear() {
+  m_nodes.clear();
+  m_items.clear();
+}
+
+bool StaticBVH::empty() const {
+  return m_items.empty();
+}
+
+void StaticBVH::query(const BoundingBox &box, EntityVector &results) const {
+  if (m_nodes.empty()) {
+    return;
+  }
+
+  // Median splits keep the tree balanced, so its depth stays far below the stack size
+  std::array<size_t, 64> stack;
+  size_t                 stackSize = 0;
+  stack[stackSize++]               = 0;
+
+  while (stackSize > 0) {
+    const size_t nodeIndex = stack[--stackSize];
+    const Node  &node      = m_nodes[nodeIndex];
+
+    if (!node.box.overlaps(box)) {
+      continue;
+    }
+
+    if (node.count > 0) {
+      for (size_t index = node.first; index < node.first + node.count; index++) {
+        if (m_items[index].box.overlaps(box)) {
+          results.push_back(m_items[index].entity);
+        }
+      }
+      continue;
+    }
+
+    stack[stackSize++] = node.right;
+    stack[stackSize++] = nodeIndex + 1;
+  }
+}
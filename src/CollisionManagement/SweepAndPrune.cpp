@@ -0,0 +1,121 @@
+#include "../../includes/CollisionManagement/SweepAndPrune.hpp"
+#include "../../includes/Helpers/CollisionHelpers.hpp"
+
+#include <algorithm>
+
+void SweepAndPrune::update(EntitySpan entities) {
+  m_updateCount++;
+  for (size_t index = 0; index < entities.size(); index++) {
+    const EntityHandle handle = entities[index].handle();
+    if (handle.index >= m_slots.size()) {
+      m_slots.resize(handle.index + 1);
+    }
+    m_slots[handle.index] = {.handle = handle, .index = index, .update = m_updateCount};
+  }
+
+  m_tracked.assign(entities.size(), false);
+
+  // Refresh the proxies of entities that are still alive, keeping their sorted order, and
+  // drop the rest.
+  std::erase_if(m_proxies, [this, &entities](Proxy &proxy) -> bool {
+    const SlotEntry &entry = m_slots[proxy.handle.index];
+    if (entry.update != m_updateCount || entry.handle != proxy.handle) {
+      return true;
+    }
+
+    const std::optional<BoundingBox> box =
+        CollisionHelpers::calculateSweptBoundingBox(entities[entry.index]);
+    if (!box.has_value()) {
+      return true;
+    }
+
+    proxy.index            = entry.index;
+    proxy.box              = *box;
+    proxy.filter           = CollisionHelpers::getCollisionFilter(entities[entry.index]);
+    m_tracked[proxy.index] = true;
+    return false;
+  });
+
+  for (size_t index = 0; index < entities.size(); index++) {
+    if (m_tracked[index]) {
+      continue;
+    }
+
+    const std::optional<BoundingBox> box =
+        CollisionHelpers::calculateSweptBoundingBox(entities[index]);
+    if (!box.has_value()) {
+      continue;
+    }
+
+    m_proxies.push_back(
+        {.handle = entities[index].handle(),
+         .index  = index,
+         .box    = *box,
+         .filter = CollisionHelpers::getCollisionFilter(entities[index])});
+  }
+
+  sortProxies();
+}
+
+void SweepAndPrune::sortProxies() {
+  for (size_t i = 1; i < m_proxies.size(); i++) {
+    const Proxy proxy = m_proxies[i];
+    size_t      j     = i;
+
+    while (j > 0 && m_proxies[j - 1].box.min.x > proxy.box.min.x) {
+      m_proxies[j] = m_proxies[j - 1];
+      j--;
+    }
+
+    m_proxies[j] = proxy;
+  }
+}
+
+const std::vector<CandidatePair> &SweepAndPrune::findCandidatePairs() {
+  m_pairs.clear();
+
+  for (size_t i = 0; i < m_proxies.size(); i++) {
+    const Proxy &proxyA = m_proxies[i];
+
+    // Proxies are sorted by left edge, so the sweep stops at the first proxy that starts
+    // past the right edge of proxyA.
+    for (size_t j = i + 1; j < m_proxies.size(); j++) {
+      const Proxy &proxyB = m_proxies[j];
+      if (proxyB.box.min.x > proxyA.box.max.x) {
+        break;
+      }
+
+      const bool overlapsVertically =
+          proxyA.box.min.y <= proxyB.box.max.y && proxyA.box.max.y >= proxyB.box.min.y;
+      if (!overlapsVertically ||
+          !CollisionHelpers::canInteract(proxyA.filter, proxyB.filter)) {
+        continue;
+      }
+
+      m_pairs.push_back({.indexA = std::min(proxyA.index, proxyB.index),
+                         .indexB = std::max(proxyA.index, proxyB.index)});
+    }
+  }
+
+  std::ranges::sort(m_pairs, [](const CandidatePair &a, const CandidatePair &b) {
+    return a.indexA != b.indexA ? a.indexA < b.indexA : a.indexB < b.indexB;
+  });
+
+  return m_pairs;
+}
+
+void SweepAndPrune::query(const BoundingBox &box, std::vector<size_t> &results) const {
+  const size_t first = results.size();
+
+  // Like the pair sweep, stop at the first proxy that starts past the box
+  for (const Proxy &proxy : m_proxies) {
+    if (proxy.box.min.x > box.max.x) {
+      break;
+    }
+    if (proxy.box.overlaps(box)) {
+      results.push_back(proxy.index);
+    }
+  }
+
+  std::sort(results.begin() + static_cast<std::ptrdiff_t>(first), results.end());
+}
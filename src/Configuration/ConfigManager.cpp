@@ -1,4 +1,6 @@
 #include "../../includes/Configuration/ConfigManager.hpp"
+#include <algorithm>
+#include <array>
 #include <fstream>
 
 template <typename JsonReturnType>
@@ -12,6 +14,17 @@ JsonReturnType ConfigManager::getJsonValue(const json        &jsonValue,
   }
 }
 
+template <typename JsonReturnType>
+JsonReturnType ConfigManager::getOptionalJsonValue(const json           &jsonValue,
+                                                   const std::string    &key,
+                                                   const JsonReturnType &fallback,
+                                                   const std::string    &context) {
+  if (!jsonValue.contains(key)) {
+    return fallback;
+  }
+  return getJsonValue<JsonReturnType>(jsonValue, key, context);
+}
+
 SDL_Color ConfigManager::parseColor(const json &colorJson, const std::string &context) {
   const auto red   = getJsonValue<Uint8>(colorJson, "r", context);
   const auto green = getJsonValue<Uint8>(colorJson, "g", context);
@@ -30,6 +43,55 @@ ShapeConfig ConfigManager::parseShapeConfig(const json        &shapeJson,
   return {height, width, color};
 }
 
+Uint32 ConfigManager::parseCollisionLayers(const json        &layersJson,
+                                           const std::string &context) {
+  // A layer's bit is its position in this list
+  constexpr std::array<const char *, 7> LAYER_NAMES = {
+      "player", "wall", "speedBoost", "slownessDebuff", "enemy", "bullet", "item"};
+
+  if (!layersJson.is_array()) {
+    throw ConfigurationError("Error parsing " + context + ": expected a list of layer names");
+  }
+
+  Uint32 layers = 0;
+  for (const json &layerJson : layersJson) {
+    const auto name  = layerJson.get<std::string>();
+    const auto layer = std::ranges::find(LAYER_NAMES, name);
+    if (layer == LAYER_NAMES.end()) {
+      throw ConfigurationError("Error parsing " + context + ": unknown collision layer '" +
+                               name + "'");
+    }
+    layers |= 1u << (layer - LAYER_NAMES.begin());
+  }
+
+  return layers;
+}
+
+CollisionFilterConfig ConfigManager::parseCollisionFilterConfig(const json        &filterJson,
+                                                                const std::string &context) {
+  const Uint32 category = parseCollisionLayers(filterJson["layers"], context + ".layers");
+  const Uint32 mask =
+      parseCollisionLayers(filterJson["collidesWith"], context + ".collidesWith");
+
+  return {.category = category, .mask = mask};
+}
+
+BroadphaseType ConfigManager::parseBroadphaseType(const std::string &name,
+                                                  const std::string &context) {
+  if (name == "bruteForce") {
+    return BroadphaseType::BruteForce;
+  }
+  if (name == "spatialHash") {
+    return BroadphaseType::SpatialHash;
+  }
+  if (name == "sweepAndPrune") {
+    return BroadphaseType::SweepAndPrune;
+  }
+
+  throw ConfigurationError("Error parsing " + context + ": unknown broadphase '" + name +
+                           "', expected bruteForce, spatialHash or sweepAndPrune");
+}
+
 void ConfigManager::parseGameConfig() {
   const auto &gameConfigJson = m_json["gameConfig"];
   const auto &sizeJson       = gameConfigJson["windowSize"];
@@ -42,10 +104,39 @@ void ConfigManager::parseGameConfig() {
   const auto spawnInterval =
       getJsonValue<Uint64>(gameConfigJson, "spawnInterval", "gameConfig");
 
-  m_gameConfig.windowSize    = Vec2(windowWidth, windowHeight);
-  m_gameConfig.windowTitle   = windowTitle;
-  m_gameConfig.fontPath      = fontPath;
-  m_gameConfig.spawnInterval = spawnInterval;
+  // Settings added after the first release fall back to their defaults, so older config
+  // files keep loading
+  const GameConfig defaults;
+  const auto       broadphase = getOptionalJsonValue<std::string>(gameConfigJson, "broadphase",
+                                                               "spatialHash", "gameConfig");
+  const auto tickRate         = getOptionalJsonValue<Uint32>(gameConfigJson, "tickRate",
+                                                             defaults.tickRate, "gameConfig");
+  const auto maxStepsPerFrame = getOptionalJsonValue<Uint32>(
+      gameConfigJson, "maxStepsPerFrame", defaults.maxStepsPerFrame, "gameConfig");
+  const auto vsync =
+      getOptionalJsonValue<bool>(gameConfigJson, "vsync", defaults.vsync, "gameConfig");
+  const auto fpsCap =
+      getOptionalJsonValue<Uint32>(gameConfigJson, "fpsCap", defaults.fpsCap, "gameConfig");
+  const auto idleStaticScenes = getOptionalJsonValue<bool>(
+      gameConfigJson, "idleStaticScenes", defaults.idleStaticScenes, "gameConfig");
+  const auto headlessSeed = getOptionalJsonValue<Uint32>(gameConfigJson, "headlessSeed",
+                                                         defaults.headlessSeed, "gameConfig");
+
+  m_gameConfig.windowSize       = Vec2(windowWidth, windowHeight);
+  m_gameConfig.windowTitle      = windowTitle;
+  m_gameConfig.fontPath         = fontPath;
+  m_gameConfig.spawnInterval    = spawnInterval;
+  m_gameConfig.broadphase       = parseBroadphaseType(broadphase, "gameConfig.broadphase");
+  m_gameConfig.tickRate         = tickRate;
+  m_gameConfig.maxStepsPerFrame = maxStepsPerFrame;
+  m_gameConfig.vsync            = vsync;
+  m_gameConfig.fpsCap           = fpsCap;
+  m_gameConfig.idleStaticScenes = idleStaticScenes;
+  m_gameConfig.headlessSeed     = headlessSeed;
+
+  if (m_gameConfig.tickRate == 0 || m_gameConfig.maxStepsPerFrame == 0) {
+    throw ConfigurationError("Tick rate and max steps per frame must be positive");
+  }
 
   if (!fs::exists(m_gameConfig.fontPath)) {
     throw ConfigurationError("Font file not found: " + m_gameConfig.fontPath.string());
@@ -59,6 +150,8 @@ void ConfigManager::parseItemConfig() {
   m_itemConfig.speed           = getJsonValue<float>(config, "speed", "itemConfig");
   m_itemConfig.spawnPercentage = getJsonValue<Uint8>(config, "spawnPercentage", "itemConfig");
   m_itemConfig.shape           = parseShapeConfig(config["shape"], "itemConfig.shape");
+  m_itemConfig.collision =
+      parseCollisionFilterConfig(config["collision"], "itemConfig.collision");
 
   if (m_itemConfig.spawnPercentage > 100) {
     throw ConfigurationError("Item spawn percentage must be between 0 and 100");
@@ -73,6 +166,8 @@ void ConfigManager::parseEnemyConfig() {
   m_enemyConfig.spawnPercentage =
       getJsonValue<Uint8>(config, "spawnPercentage", "enemyConfig");
   m_enemyConfig.shape = parseShapeConfig(config["shape"], "enemyConfig.shape");
+  m_enemyConfig.collision =
+      parseCollisionFilterConfig(config["collision"], "enemyConfig.collision");
 
   if (m_enemyConfig.spawnPercentage > 100) {
     throw ConfigurationError("Enemy spawn percentage must be between 0 and 100");
@@ -88,6 +183,8 @@ void ConfigManager::parseSpeedEffectConfig() {
 
   m_speedEffectConfig.spawnPercentage =
       getJsonValue<unsigned int>(config, "spawnPercentage", "speedEffectConfig");
+  m_speedEffectConfig.collision =
+      parseCollisionFilterConfig(config["collision"], "speedEffectConfig.collision");
 
   if (m_speedEffectConfig.spawnPercentage > 100) {
     throw ConfigurationError("SpeedBoost spawn percentage must be between 0 and 100");
@@ -104,6 +201,8 @@ void ConfigManager::parseSlownessEffectConfig() {
       getJsonValue<unsigned int>(config, "spawnPercentage", "slownessEffectConfig");
   m_slownessEffectConfig.shape =
       parseShapeConfig(config["shape"], "slownessEffectConfig.shape");
+  m_slownessEffectConfig.collision =
+      parseCollisionFilterConfig(config["collision"], "slownessEffectConfig.collision");
 
   if (m_slownessEffectConfig.spawnPercentage > 100) {
     throw ConfigurationError("Slowness spawn percentage must be between 0 and 100");
@@ -116,6 +215,43 @@ void ConfigManager::parseBulletConfig() {
   m_bulletConfig.speed    = getJsonValue<float>(config, "speed", "bulletConfig");
   m_bulletConfig.lifespan = getJsonValue<Uint64>(config, "lifespan", "bulletConfig");
   m_bulletConfig.shape    = parseShapeConfig(config["shape"], "bulletConfig.shape");
+  m_bulletConfig.collision =
+      parseCollisionFilterConfig(config["collision"], "bulletConfig.collision");
+}
+
+void ConfigManager::parseWallConfig() {
+  const auto &config = m_json["wallConfig"];
+
+  m_wallConfig.collision =
+      parseCollisionFilterConfig(config["collision"], "wallConfig.collision");
+}
+
+void ConfigManager::parseBenchmarkConfig() {
+  const auto &config = m_json["benchmarkConfig"];
+
+  m_benchmarkConfig.seed  = getJsonValue<Uint32>(config, "seed", "benchmarkConfig");
+  m_benchmarkConfig.ticks = getJsonValue<Uint64>(config, "ticks", "benchmarkConfig");
+  m_benchmarkConfig.outputPath =
+      getJsonValue<fs::path>(config, "outputPath", "benchmarkConfig");
+
+  const auto        &mix        = config["mix"];
+  const std::string  mixContext = "benchmarkConfig.mix";
+  m_benchmarkConfig.enemyPercentage  = getJsonValue<Uint8>(mix, "enemy", mixContext);
+  m_benchmarkConfig.bulletPercentage = getJsonValue<Uint8>(mix, "bullet", mixContext);
+  m_benchmarkConfig.itemPercentage   = getJsonValue<Uint8>(mix, "item", mixContext);
+  m_benchmarkConfig.effectPercentage = getJsonValue<Uint8>(mix, "effect", mixContext);
+
+  const int totalPercentage =
+      m_benchmarkConfig.enemyPercentage + m_benchmarkConfig.bulletPercentage +
+      m_benchmarkConfig.itemPercentage + m_benchmarkConfig.effectPercentage;
+
+  if (totalPercentage != 100) {
+    throw ConfigurationError("Benchmark entity mix must add up to 100 percent");
+  }
+
+  if (m_benchmarkConfig.ticks == 0) {
+    throw ConfigurationError("Benchmark tick count must be positive");
+  }
 }
 
 void ConfigManager::parsePlayerConfig() {
@@ -127,6 +263,8 @@ void ConfigManager::parsePlayerConfig() {
   m_playerConfig.slownessMultiplier =
       getJsonValue<float>(config, "slownessMultiplier", "playerConfig");
   m_playerConfig.shape = parseShapeConfig(config["shape"], "playerConfig.shape");
+  m_playerConfig.collision =
+      parseCollisionFilterConfig(config["collision"], "playerConfig.collision");
 
   if (m_playerConfig.speedBoostMultiplier <= 0 || m_playerConfig.slownessMultiplier <= 0) {
     throw ConfigurationError("Player speed multipliers must be positive");
@@ -142,6 +280,8 @@ void ConfigManager::parseConfig() {
     parseBulletConfig();
     parseSpeedEffectConfig();
     parseSlownessEffectConfig();
+    parseWallConfig();
+    parseBenchmarkConfig();
   } catch (const json::exception &e) {
     throw ConfigurationError("JSON parsing error: " + std::string(e.what()));
   }
@@ -208,6 +348,14 @@ const SlownessEffectConfig &ConfigManager::getSlownessEffectConfig() const {
   return m_slownessEffectConfig;
 }
 
+const WallConfig &ConfigManager::getWallConfig() const {
+  return m_wallConfig;
+}
+
+const BenchmarkConfig &ConfigManager::getBenchmarkConfig() const {
+  return m_benchmarkConfig;
+}
+
 void ConfigManager::updatePlayerShape(const ShapeConfig &shape) {
   m_playerConfig.shape = shape;
 }
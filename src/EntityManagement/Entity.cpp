@@ -1,28 +1,44 @@
 #include "../../includes/EntityManagement/Entity.hpp"
+#include "../../includes/EntityManagement/EntityAccessors.hpp"
 #include <iostream>
 
-Entity::Entity(const size_t id, const EntityTags tag) :
-    m_id(id), m_tag(tag) {}
+Entity::Entity(EntityManager *manager, const EntityHandle handle) :
+    m_manager(manager), m_handle(handle) {}
+
+bool Entity::isValid() const {
+  return m_manager != nullptr && m_manager->isValid(m_handle);
+}
 
 bool Entity::isActive() const {
-  return m_active;
+  return isValid() && m_manager->m_slots[m_handle.index].active;
 }
 
 EntityTags Entity::tag() const {
-  return m_tag;
+  if (!isValid()) {
+    return Default;
+  }
+  return m_manager->m_slots[m_handle.index].tag;
 }
 
 size_t Entity::id() const {
-  return m_id;
+  return m_handle.index;
 }
 
-void Entity::destroy() {
-  m_active = false;
+EntityHandle Entity::handle() const {
+  return m_handle;
+}
+
+void Entity::destroy() const {
+  if (!isActive()) {
+    return;
+  }
+  m_manager->m_slots[m_handle.index].active = false;
+  m_manager->m_toRemove.push_back(*this);
 }
 
 Vec2 Entity::getCenterPos() const {
-  const std::shared_ptr<CTransform> &cTransform = getComponent<CTransform>();
-  const std::shared_ptr<CShape>     &cShape     = getComponent<CShape>();
+  const CTransform *cTransform = getComponent<CTransform>();
+  const CShape     *cShape     = getComponent<CShape>();
 
   if (cTransform == nullptr || cShape == nullptr) {
     SDL_LogError(
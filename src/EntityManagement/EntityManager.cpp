@@ -1,40 +1,85 @@
-
 #include "../../includes/EntityManagement/EntityManager.hpp"
 #include "../../includes/EntityManagement/Entity.hpp"
-#include <ranges> // For std::ranges::views
+#include "../../includes/GameEngine/TraceRecorder.hpp"
 
 EntityManager::EntityManager() = default;
 
-std::shared_ptr<Entity> EntityManager::addEntity(const EntityTags tag) {
-  auto entityToAdd = std::shared_ptr<Entity>(new Entity(m_totalEntities++, tag));
+Entity EntityManager::addEntity(const EntityTags tag) {
+  // The component store recycles released slots, so the slot table only grows when the store
+  // does.
+  const size_t slot = m_components.allocateSlot();
+  if (slot == m_slots.size()) {
+    m_slots.emplace_back();
+  }
+
+  EntitySlot &entitySlot = m_slots[slot];
+  entitySlot.tag         = tag;
+  entitySlot.active      = true;
+
+  const Entity entityToAdd(this, {.index      = static_cast<uint32_t>(slot),
+                                  .generation = entitySlot.generation});
   m_toAdd.push_back(entityToAdd);
   return entityToAdd;
 }
 
-EntityVector &EntityManager::getEntities() {
+Entity EntityManager::getEntity(const EntityHandle handle) {
+  return {this, handle};
+}
+
+bool EntityManager::isValid(const EntityHandle handle) const {
+  return handle.index < m_slots.size() &&
+         m_slots[handle.index].generation == handle.generation;
+}
+
+EntitySpan EntityManager::getEntities() const {
   return m_entities;
 }
-EntityVector &EntityManager::getEntities(const EntityTags tag) {
-  return m_entityMap[tag];
+EntitySpan EntityManager::getEntities(const EntityTags tag) const {
+  return m_entitiesByTag[tag];
+}
+
+EntitySpan EntityManager::getPendingEntities() const {
+  return m_toAdd;
+}
+
+bool EntityManager::hasPendingChanges() const {
+  return !m_toAdd.empty() || !m_toRemove.empty();
 }
 
 void EntityManager::update() {
-  auto removeDeadEntities = [](EntityVector &entityVec) {
-    std::erase_if(entityVec, [](auto &entity) { return !entity->isActive(); });
-  };
+  const TraceRecorder::Scope trace("EntityManager::update");
 
   // add all entities in the `m_toAdd` vector to the main entity vector
-  for (const std::shared_ptr<Entity> &entity : m_toAdd) {
+  for (const Entity &entity : m_toAdd) {
+    EntitySlot   &entitySlot = m_slots[entity.m_handle.index];
+    EntityVector &tagged     = m_entitiesByTag[entitySlot.tag];
+
+    entitySlot.entityIndex = m_entities.size();
+    entitySlot.tagIndex    = tagged.size();
     m_entities.push_back(entity);
-    m_entityMap[entity->tag()].push_back(entity);
+    tagged.push_back(entity);
   }
+  m_toAdd.clear();
 
-  // Remove dead entities from the vector of all entities
-  removeDeadEntities(m_entities);
-  // Remove dead entities from each vector in the entity map
-  for (auto &entityVec : m_entityMap | std::views::values) {
-    removeDeadEntities(entityVec);
-  }
+  // Move the last entity into the removed entity's place, so removal does not shift the rest
+  auto swapAndPop = [this](EntityVector &list, size_t position, size_t EntitySlot::*field) {
+    const Entity last = list.back();
+    list[position]    = last;
+    m_slots[last.m_handle.index].*field = position;
+    list.pop_back();
+  };
 
-  m_toAdd.clear();
+  // Release the slots of dead entities. Bumping the generation invalidates every handle that
+  // still refers to them.
+  for (const Entity &entity : m_toRemove) {
+    const uint32_t index      = entity.m_handle.index;
+    EntitySlot    &entitySlot = m_slots[index];
+
+    swapAndPop(m_entities, entitySlot.entityIndex, &EntitySlot::entityIndex);
+    swapAndPop(m_entitiesByTag[entitySlot.tag], entitySlot.tagIndex, &EntitySlot::tagIndex);
+
+    m_components.releaseSlot(index);
+    entitySlot.generation++;
+  }
+  m_toRemove.clear();
 }
@@ -0,0 +1,33 @@
+#include "../../includes/GameEngine/FrameLimiter.hpp"
+
+FrameLimiter::FrameLimiter(const Uint32 fpsCap) {
+  if (fpsCap > 0) {
+    m_frameTicks = SDL_GetPerformanceFrequency() / fpsCap;
+  }
+}
+
+void FrameLimiter::wait() {
+  if (m_frameTicks == 0) {
+    return;
+  }
+
+  constexpr Uint64 SPIN_MILLISECONDS = 2;
+  const Uint64     frequency         = SDL_GetPerformanceFrequency();
+  const Uint64     spinTicks         = frequency * SPIN_MILLISECONDS / 1000;
+
+  Uint64 now = SDL_GetPerformanceCounter();
+  if (m_nextFrame == 0 || now >= m_nextFrame + m_frameTicks) {
+    m_nextFrame = now + m_frameTicks;
+    return;
+  }
+
+  while (now + spinTicks < m_nextFrame) {
+    SDL_Delay(static_cast<Uint32>((m_nextFrame - spinTicks - now) * 1000 / frequency));
+    now = SDL_GetPerformanceCounter();
+  }
+  while (now < m_nextFrame) {
+    now = SDL_GetPerformanceCounter();
+  }
+
+  m_nextFrame += m_frameTicks;
+}
@@ -0,0 +1,60 @@
+#include "../../includes/GameEngine/FrameProfiler.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+void FrameProfiler::sampleFrame(const SystemTimer &systemTimer) {
+  const std::vector<SystemTimer::Timing> timings = systemTimer.getTimings();
+
+  // The timer only ever appends systems, so series and timings share their indices
+  for (size_t index = m_series.size(); index < timings.size(); index++) {
+    m_series.push_back({.name = timings[index].name});
+  }
+
+  for (size_t index = 0; index < timings.size(); index++) {
+    Series      &series     = m_series[index];
+    const Uint64 totalTicks = timings[index].totalTicks;
+
+    series.samples[m_nextFrame] = totalTicks - series.lastTotalTicks;
+    series.lastTotalTicks       = totalTicks;
+  }
+
+  m_nextFrame  = (m_nextFrame + 1) % FRAME_COUNT;
+  m_frameCount = std::min(m_frameCount + 1, FRAME_COUNT);
+}
+
+const std::vector<FrameProfiler::Stats> &FrameProfiler::computeStats() {
+  m_stats.resize(m_series.size());
+  if (m_frameCount == 0) {
+    return m_stats;
+  }
+
+  // Until the buffer wraps, only its first m_frameCount slots hold samples
+  const size_t p99Index = m_frameCount * 99 / 100;
+
+  for (size_t index = 0; index < m_series.size(); index++) {
+    const Series &series = m_series[index];
+    m_sortedSamples.assign(series.samples.begin(), series.samples.begin() + m_frameCount);
+    std::ranges::sort(m_sortedSamples);
+
+    const Uint64 totalTicks =
+        std::accumulate(m_sortedSamples.begin(), m_sortedSamples.end(), Uint64{0});
+
+    m_stats[index] = {
+        .name                = series.name,
+        .minMicroseconds     = SystemTimer::toMicroseconds(m_sortedSamples.front()),
+        .averageMicroseconds = SystemTimer::toMicroseconds(totalTicks) /
+                               static_cast<double>(m_frameCount),
+        .p99Microseconds     = SystemTimer::toMicroseconds(m_sortedSamples[p99Index])};
+  }
+
+  return m_stats;
+}
+
+void FrameProfiler::toggleVisible() {
+  m_visible = !m_visible;
+}
+
+bool FrameProfiler::isVisible() const {
+  return m_visible;
+}
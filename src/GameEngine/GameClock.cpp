@@ -0,0 +1,17 @@
+#include "../../includes/GameEngine/GameClock.hpp"
+
+bool   GameClock::m_manual      = false;
+Uint64 GameClock::m_manualTicks = 0;
+
+Uint64 GameClock::getTicks() {
+  return m_manual ? m_manualTicks : SDL_GetTicks64();
+}
+
+void GameClock::useManualClock(const Uint64 startTicks) {
+  m_manual      = true;
+  m_manualTicks = startTicks;
+}
+
+void GameClock::advance(const Uint64 milliseconds) {
+  m_manualTicks += milliseconds;
+}
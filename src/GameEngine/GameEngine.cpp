@@ -1,4 +1,6 @@
 #include "../../includes/GameEngine/GameEngine.hpp"
+#include "../../includes/GameEngine/FrameLimiter.hpp"
+#include "../../includes/GameEngine/GameClock.hpp"
 #include "../../includes/GameScenes/MainScene.hpp"
 #include "../../includes/GameScenes/MenuScene.hpp"
 #include "../../includes/SystemManagement/VideoManager.hpp"
@@ -7,7 +9,8 @@
 #include <emscripten.h>
 #endif
 
-GameEngine::GameEngine() {
+GameEngine::GameEngine(const bool headless, const size_t benchmarkEntityCount) :
+    m_headless(headless), m_benchmarkEntityCount(benchmarkEntityCount) {
   const Path ASSETS_DIR_PATH  = "assets";
   const Path CONFIG_DIR_PATH  = "config";
   const Path CONFIG_FILE_PATH = CONFIG_DIR_PATH / "config.json";
@@ -19,19 +22,31 @@ GameEngine::GameEngine() {
   }
 
   m_configManager    = createConfigManager(CONFIG_FILE_PATH);
-  m_audioManager     = createAudioManager();
+  m_audioManager     = createAudioManager(m_headless);
   m_audioSampleQueue = initializeAudioSampleQueue();
-  m_fontManager      = createFontManager();
   m_videoManager     = createVideoManager();
+  m_fontManager      = createFontManager();
 
   m_isRunning = true;
 
   SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Game engine initialized successfully!");
+
+  // sTimer ignores frames longer than the scene start time, so the clock starts one second in
+  if (m_headless) {
+    GameClock::useManualClock(1000);
+    const std::shared_ptr<Scene> mainScene =
+        std::make_shared<MainScene>(this, m_benchmarkEntityCount);
+    loadScene("Main", mainScene);
+    return;
+  }
+
   const std::shared_ptr<Scene> menuScene = std::make_shared<MenuScene>(this);
   loadScene("Menu", menuScene);
 }
 
 GameEngine::~GameEngine() {
+  // Scenes can own textures, so they go before the renderer does
+  m_scenes.clear();
   cleanup();
 }
 
@@ -46,16 +61,16 @@ std::unique_ptr<VideoManager> GameEngine::createVideoManager() {
     throw std::runtime_error("ConfigManager not initialized");
   }
 
-  return std::make_unique<VideoManager>(*m_configManager);
+  return std::make_unique<VideoManager>(*m_configManager, m_headless);
 }
 
-std::unique_ptr<AudioManager> GameEngine::createAudioManager() {
+std::unique_ptr<AudioManager> GameEngine::createAudioManager(const bool headless) {
   constexpr int    FREQUENCY = 44100;
   constexpr Uint16 FORMAT    = MIX_DEFAULT_FORMAT;
   constexpr int    CHANNELS  = 2;
   constexpr int    CHUNKSIZE = 2048;
 
-  return std::make_unique<AudioManager>(FREQUENCY, FORMAT, CHANNELS, CHUNKSIZE);
+  return std::make_unique<AudioManager>(FREQUENCY, FORMAT, CHANNELS, CHUNKSIZE, headless);
 }
 
 std::unique_ptr<AudioSampleQueue> GameEngine::initializeAudioSampleQueue() {
@@ -69,7 +84,7 @@ std::unique_ptr<AudioSampleQueue> GameEngine::initializeAudioSampleQueue() {
 
 /**
  * @brief Create a FontManager object
- * @throws std::runtime_error if ConfigManager is not initialized
+ * @throws std::runtime_error if ConfigManager or VideoManager is not initialized
  */
 std::unique_ptr<FontManager> GameEngine::createFontManager() {
   if (m_configManager == nullptr) {
@@ -78,8 +93,14 @@ std::unique_ptr<FontManager> GameEngine::createFontManager() {
     throw std::runtime_error("ConfigManager not initialized");
   }
 
+  if (m_videoManager == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "VideoManager not initialized");
+    cleanup();
+    throw std::runtime_error("VideoManager not initialized");
+  }
+
   const std::string &fontPath = m_configManager->getGameConfig().fontPath;
-  return std::make_unique<FontManager>(fontPath);
+  return std::make_unique<FontManager>(fontPath, m_videoManager->getRenderer());
 }
 
 void GameEngine::cleanup() {
@@ -100,12 +121,42 @@ bool GameEngine::isRunning() const {
   return m_isRunning;
 }
 
-void GameEngine::run() {
+bool GameEngine::isHeadless() const {
+  return m_headless;
+}
+
+bool GameEngine::canIdle() {
+  const std::shared_ptr<Scene> &activeScene = m_scenes[m_currentSceneName];
+
+  // A freshly loaded scene has not been drawn yet
+  return !m_headless && m_configManager->getGameConfig().idleStaticScenes && !m_sceneLoaded &&
+         activeScene != nullptr && activeScene->isStatic();
+}
+
+void GameEngine::run(const Uint64 maxFrames) {
+  const GameConfig &gameConfig = m_configManager->getGameConfig();
 #ifdef __EMSCRIPTEN__
-  emscripten_set_main_loop_arg(mainLoop, this, 0, 1);
+  // The browser paces frames, at the display's refresh rate when there is no cap
+  emscripten_set_main_loop_arg(mainLoop, this, static_cast<int>(gameConfig.fpsCap), 1);
 #else
-  while (m_isRunning) {
+  const Uint64 tickRate = gameConfig.tickRate;
+  FrameLimiter frameLimiter(m_headless ? 0 : gameConfig.fpsCap);
+
+  for (Uint64 frame = 0; m_isRunning && (maxFrames == 0 || frame < maxFrames); frame++) {
+    // A tick rarely lasts a whole number of milliseconds. Moving the clock to the rounded end
+    // of tick `frame + 1`, rather than by a rounded tick length, keeps it from drifting.
+    if (m_headless) {
+      GameClock::advance((frame + 1) * 1000 / tickRate - frame * 1000 / tickRate);
+    }
+
+    // Leaves the event in the queue for sUserInput
+    if (canIdle()) {
+      SDL_WaitEvent(nullptr);
+    }
+
+    m_sceneLoaded = false;
     mainLoop(this);
+    frameLimiter.wait();
   }
 #endif
 }
@@ -122,8 +173,9 @@ void GameEngine::quit() {
 void GameEngine::loadScene(const std::string &sceneName, const std::shared_ptr<Scene> &scene) {
   m_scenes[sceneName] = scene;
 
-  scene->setStartTime(SDL_GetTicks64());
+  scene->setStartTime(GameClock::getTicks());
   m_currentSceneName = sceneName;
+  m_sceneLoaded      = true;
 }
 
 ConfigManager &GameEngine::getConfigManager() const {
@@ -167,6 +219,16 @@ VideoManager &GameEngine::getVideoManager() const {
   return *m_videoManager;
 }
 
+SystemTimer &GameEngine::getSystemTimer() {
+  return m_systemTimer;
+}
+
+#ifdef ENABLE_PROFILER
+FrameProfiler &GameEngine::getFrameProfiler() {
+  return m_frameProfiler;
+}
+#endif
+
 void GameEngine::sUserInput() {
   SDL_Event                    event;
   const std::shared_ptr<Scene> activeScene = m_scenes[m_currentSceneName];
@@ -177,6 +239,10 @@ void GameEngine::sUserInput() {
       return;
     }
 
+    if (event.type == SDL_RENDER_TARGETS_RESET) {
+      activeScene->onRenderTargetsReset();
+    }
+
     // Handle window events
     if (event.type == SDL_WINDOWEVENT) {
       switch (event.window.event) {
@@ -247,6 +313,13 @@ void GameEngine::mainLoop(void *arg) {
     return;
   }
 #endif
-  gameEngine->sUserInput();
-  gameEngine->update();
+  SystemTimer &systemTimer = gameEngine->m_systemTimer;
+  if (!gameEngine->m_headless) {
+    systemTimer.measure("sUserInput", [gameEngine]() -> void { gameEngine->sUserInput(); });
+  }
+  systemTimer.measure("update", [gameEngine]() -> void { gameEngine->update(); });
+
+#ifdef ENABLE_PROFILER
+  gameEngine->m_frameProfiler.sampleFrame(systemTimer);
+#endif
 }
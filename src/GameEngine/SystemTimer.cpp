@@ -0,0 +1,32 @@
+#include "../../includes/GameEngine/SystemTimer.hpp"
+
+#include <algorithm>
+
+void SystemTimer::record(const std::string_view name, const Uint64 ticks) {
+  const std::lock_guard lock(m_mutex);
+
+  auto timing = std::ranges::find(m_timings, name, &Timing::name);
+  if (timing == m_timings.end()) {
+    m_timings.push_back({.name = std::string(name)});
+    timing = m_timings.end() - 1;
+  }
+
+  timing->calls++;
+  timing->totalTicks += ticks;
+  timing->maxTicks = std::max(timing->maxTicks, ticks);
+}
+
+void SystemTimer::clear() {
+  const std::lock_guard lock(m_mutex);
+  m_timings.clear();
+}
+
+std::vector<SystemTimer::Timing> SystemTimer::getTimings() const {
+  const std::lock_guard lock(m_mutex);
+  return m_timings;
+}
+
+double SystemTimer::toMicroseconds(const Uint64 ticks) {
+  return static_cast<double>(ticks) * 1'000'000.0 /
+         static_cast<double>(SDL_GetPerformanceFrequency());
+}
@@ -0,0 +1,121 @@
+#include "../../includes/GameEngine/TraceRecorder.hpp"
+
+#include <chrono>
+#include <stdexcept>
+
+std::atomic<bool>                 TraceRecorder::m_enabled = false;
+std::mutex                        TraceRecorder::m_mutex;
+std::condition_variable           TraceRecorder::m_flushRequested;
+std::vector<TraceRecorder::Event> TraceRecorder::m_pending;
+std::thread                       TraceRecorder::m_writer;
+std::ofstream                     TraceRecorder::m_output;
+Uint64                            TraceRecorder::m_startCounter = 0;
+bool                              TraceRecorder::m_stopping     = false;
+bool                              TraceRecorder::m_firstEvent   = true;
+
+void TraceRecorder::start(const std::filesystem::path &path) {
+  if (m_enabled) {
+    return;
+  }
+
+  m_output.open(path, std::ios::trunc);
+  if (!m_output.is_open()) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Failed to open trace output: %s", path.c_str());
+    throw std::runtime_error("Failed to open trace output");
+  }
+
+  m_output << "{\"traceEvents\":[\n";
+  m_startCounter = SDL_GetPerformanceCounter();
+  m_stopping     = false;
+  m_firstEvent   = true;
+  m_writer       = std::thread(runWriter);
+  m_enabled      = true;
+
+  SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Recording trace to %s", path.c_str());
+}
+
+void TraceRecorder::stop() {
+  if (!m_enabled) {
+    return;
+  }
+  m_enabled = false;
+
+  {
+    std::lock_guard lock(m_mutex);
+    m_stopping = true;
+  }
+  m_flushRequested.notify_one();
+  m_writer.join();
+
+  m_output << "\n]}\n";
+  m_output.close();
+}
+
+bool TraceRecorder::isEnabled() {
+  return m_enabled.load(std::memory_order_relaxed);
+}
+
+void TraceRecorder::begin(const std::string_view name) {
+  if (isEnabled()) {
+    record(name, 'B');
+  }
+}
+
+void TraceRecorder::end(const std::string_view name) {
+  if (isEnabled()) {
+    record(name, 'E');
+  }
+}
+
+void TraceRecorder::record(const std::string_view name, const char phase) {
+  // Trace timestamps are in microseconds since recording started
+  const auto elapsed   = static_cast<double>(SDL_GetPerformanceCounter() - m_startCounter);
+  const auto timestamp = static_cast<Uint64>(
+      elapsed * 1'000'000.0 / static_cast<double>(SDL_GetPerformanceFrequency()));
+
+  const Event event = {
+      .name = name, .phase = phase, .timestamp = timestamp, .threadId = getThreadId()};
+
+  std::lock_guard lock(m_mutex);
+  m_pending.push_back(event);
+}
+
+Uint32 TraceRecorder::getThreadId() {
+  static std::atomic<Uint32> nextThreadId = 1;
+  thread_local const Uint32  threadId     = nextThreadId++;
+  return threadId;
+}
+
+void TraceRecorder::runWriter() {
+  constexpr auto FLUSH_INTERVAL = std::chrono::milliseconds(100);
+
+  std::vector<Event> events;
+  bool               stopping = false;
+
+  while (!stopping) {
+    {
+      std::unique_lock lock(m_mutex);
+      m_flushRequested.wait_for(lock, FLUSH_INTERVAL, []() -> bool { return m_stopping; });
+
+      // Swap buffers so recording threads only ever wait for the swap, never for the disk
+      events.swap(m_pending);
+      stopping = m_stopping;
+    }
+
+    writeEvents(events);
+    events.clear();
+  }
+}
+
+void TraceRecorder::writeEvents(const std::vector<Event> &events) {
+  for (const auto &[name, phase, timestamp, threadId] : events) {
+    if (!m_firstEvent) {
+      m_output << ",\n";
+    }
+    m_firstEvent = false;
+
+    m_output << R"({"name":")" << name << R"(","ph":")" << phase
+             << R"(","pid":1,"tid":)" << threadId << R"(,"ts":)" << timestamp << '}';
+  }
+  m_output.flush();
+}
@@ -0,0 +1,74 @@
+#include "../../includes/GameEngine/WorkerThread.hpp"
+
+#include <utility>
+
+WorkerThread::WorkerThread() {
+#ifndef __EMSCRIPTEN__
+  m_thread = std::thread([this]() -> void { run(); });
+#endif
+}
+
+WorkerThread::~WorkerThread() {
+#ifndef __EMSCRIPTEN__
+  {
+    std::unique_lock lock(m_mutex);
+    // Let a running job finish, since it may still use whatever owns this worker
+    m_changed.wait(lock, [this]() -> bool { return !m_busy; });
+    m_stopping = true;
+  }
+  m_changed.notify_all();
+  m_thread.join();
+#endif
+}
+
+void WorkerThread::start(std::function<void()> job) {
+#ifdef __EMSCRIPTEN__
+  try {
+    job();
+  } catch (...) {
+    m_error = std::current_exception();
+  }
+#else
+  {
+    const std::lock_guard lock(m_mutex);
+    m_job  = std::move(job);
+    m_busy = true;
+  }
+  m_changed.notify_all();
+#endif
+}
+
+void WorkerThread::wait() {
+  std::unique_lock lock(m_mutex);
+  m_changed.wait(lock, [this]() -> bool { return !m_busy; });
+
+  if (m_error != nullptr) {
+    std::rethrow_exception(std::exchange(m_error, nullptr));
+  }
+}
+
+void WorkerThread::run() {
+  std::unique_lock lock(m_mutex);
+
+  while (true) {
+    m_changed.wait(lock, [this]() -> bool { return m_busy || m_stopping; });
+    if (m_stopping) {
+      return;
+    }
+
+    // The job runs unlocked, so `wait` can block on the condition in the meantime
+    lock.unlock();
+    std::exception_ptr error;
+    try {
+      m_job();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    lock.lock();
+
+    m_job   = nullptr;
+    m_error = error;
+    m_busy  = false;
+    m_changed.notify_all();
+  }
+}
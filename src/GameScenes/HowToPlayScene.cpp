@@ -1,12 +1,13 @@
 #include "../../includes/GameScenes/HowToPlayScene.hpp"
 #include "../../includes/GameScenes/MenuScene.hpp"
-#include "../../includes/Helpers/TextHelpers.hpp"
 #include <SDL2/SDL.h>
 
 HowToPlayScene::HowToPlayScene(GameEngine *gameEngine) :
     Scene(gameEngine) {
   registerAction(SDLK_RETURN, "SELECT");
   registerAction(SDLK_BACKSPACE, "GO_BACK");
+
+  createLabels();
 }
 
 void HowToPlayScene::update() {
@@ -24,100 +25,103 @@ void HowToPlayScene::onEnd() {
 
 void HowToPlayScene::sRender() {
   SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
-  SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-  SDL_RenderClear(renderer);
-  renderText();
+
+  // The text is only drawn again after something on screen changed
+  m_frame.render(renderer, [this, renderer]() -> void {
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderClear(renderer);
+    renderText();
+  });
   SDL_RenderPresent(renderer);
 }
 
-void HowToPlayScene::renderText() const {
-  SDL_Renderer       *renderer  = m_gameEngine->getVideoManager().getRenderer();
-  TTF_Font           *fontSm    = m_gameEngine->getFontManager().getFontSm();
-  TTF_Font           *fontMd    = m_gameEngine->getFontManager().getFontMd();
-  TTF_Font           *fontLg    = m_gameEngine->getFontManager().getFontLg();
-  constexpr SDL_Color textColor = {.r = 255, .g = 255, .b = 255, .a = 255};
+void HowToPlayScene::onSceneWindowResize() {
+  m_frame.invalidate();
+}
 
-  const bool fontsLoaded = fontSm != nullptr && fontMd != nullptr && fontLg != nullptr;
+void HowToPlayScene::onRenderTargetsReset() {
+  m_frame.invalidate();
+}
 
-  if (!fontsLoaded) {
-    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Failed to load fonts as they are null.");
-    return;
-  }
+void HowToPlayScene::createLabels() {
+  const GlyphAtlas   *fontSm    = m_gameEngine->getFontManager().getGlyphAtlasSm();
+  const GlyphAtlas   *fontMd    = m_gameEngine->getFontManager().getGlyphAtlasMd();
+  const GlyphAtlas   *fontLg    = m_gameEngine->getFontManager().getGlyphAtlasLg();
+  constexpr SDL_Color textColor = {.r = 255, .g = 255, .b = 255, .a = 255};
 
   // Instructions text
-  const std::string titleText = "How to Play";
-  const Vec2        titlePos  = {100, 100};
-  TextHelpers::renderLineOfText(renderer, fontLg, titleText, textColor, titlePos);
+  const Vec2 titlePos = {100, 100};
+  m_labels.emplace_back(fontLg, "How to Play", textColor, titlePos);
 
   // Movement instructions
-  const std::string controlsText = "Controls";
-  const Vec2        controlsPos  = titlePos + Vec2{0, 80};
-  TextHelpers::renderLineOfText(renderer, fontMd, controlsText, textColor, controlsPos);
+  const Vec2 controlsPos = titlePos + Vec2{0, 80};
+  m_labels.emplace_back(fontMd, "Controls", textColor, controlsPos);
 
-  const std::string wText = "W: Move Up";
-  const Vec2        wPos  = controlsPos + Vec2{0, 80};
-  TextHelpers::renderLineOfText(renderer, fontSm, wText, textColor, wPos);
+  const Vec2 wPos = controlsPos + Vec2{0, 80};
+  m_labels.emplace_back(fontSm, "W: Move Up", textColor, wPos);
 
-  const std::string sText = "S: Move Down";
-  const Vec2        sPos  = wPos + Vec2{0, 40};
-  TextHelpers::renderLineOfText(renderer, fontSm, sText, textColor, sPos);
+  const Vec2 sPos = wPos + Vec2{0, 40};
+  m_labels.emplace_back(fontSm, "S: Move Down", textColor, sPos);
 
-  const std::string aText = "A: Move Left";
-  const Vec2        aPos  = sPos + Vec2{0, 40};
-  TextHelpers::renderLineOfText(renderer, fontSm, aText, textColor, aPos);
+  const Vec2 aPos = sPos + Vec2{0, 40};
+  m_labels.emplace_back(fontSm, "A: Move Left", textColor, aPos);
 
-  const std::string dText = "D: Move Right";
-  const Vec2        dPos  = aPos + Vec2{0, 40};
-  TextHelpers::renderLineOfText(renderer, fontSm, dText, textColor, dPos);
+  const Vec2 dPos = aPos + Vec2{0, 40};
+  m_labels.emplace_back(fontSm, "D: Move Right", textColor, dPos);
 
-  const std::string enterText = "Enter: Select";
-  const Vec2        enterPos  = dPos + Vec2{0, 80};
-  TextHelpers::renderLineOfText(renderer, fontSm, enterText, textColor, enterPos);
+  const Vec2 enterPos = dPos + Vec2{0, 80};
+  m_labels.emplace_back(fontSm, "Enter: Select", textColor, enterPos);
 
-  const std::string backText = "Back: Backspace";
-  const Vec2        backPos  = enterPos + Vec2{0, 40};
-  TextHelpers::renderLineOfText(renderer, fontSm, backText, textColor, backPos);
+  const Vec2 backPos = enterPos + Vec2{0, 40};
+  m_labels.emplace_back(fontSm, "Back: Backspace", textColor, backPos);
 
-  const std::string shootText = "Mouse Click: Shoot";
-  const Vec2        shootPos  = backPos + Vec2{0, 40};
-  TextHelpers::renderLineOfText(renderer, fontSm, shootText, textColor, shootPos);
+  const Vec2 shootPos = backPos + Vec2{0, 40};
+  m_labels.emplace_back(fontSm, "Mouse Click: Shoot", textColor, shootPos);
 
   // Objectives text
+  const Vec2 objectivesPos = controlsPos + Vec2{350, 0};
+  m_labels.emplace_back(fontMd, "Objectives", textColor, objectivesPos);
+
+  const std::string objectiveTexts[] = {
+      "1. Collect the yellow squares to increase your score.",
+      "2. Avoid the red squares as they will decrease your lives.",
+      "3. Collect the green squares to gain a speed boost.",
+      "4. Avoid purple squares as they will slow you down.",
+      "5. Shoot down red squares to increase your score.",
+      "6. Avoid shooting any squares you want to collect.",
+  };
+
+  Vec2 objectivePos = objectivesPos + Vec2{0, 40};
+  for (const std::string &objectiveText : objectiveTexts) {
+    objectivePos += Vec2{0, 40};
+    m_labels.emplace_back(fontSm, objectiveText, textColor, objectivePos);
+  }
 
-  const std::string objectivesText = "Objectives";
-  const Vec2        objectivesPos  = controlsPos + Vec2{350, 0};
-  TextHelpers::renderLineOfText(renderer, fontMd, objectivesText, textColor, objectivesPos);
-
-  const std::string objective1Text = "1. Collect the yellow squares to increase your score.";
-  const Vec2        objective1Pos  = objectivesPos + Vec2{0, 80};
-  TextHelpers::renderLineOfText(renderer, fontSm, objective1Text, textColor, objective1Pos);
-
-  const std::string objective2Text =
-      "2. Avoid the red squares as they will decrease your lives.";
-  const Vec2 objective2Pos = objective1Pos + Vec2{0, 40};
-  TextHelpers::renderLineOfText(renderer, fontSm, objective2Text, textColor, objective2Pos);
+  // How to exit text, positioned every frame to follow the window size
+  m_exitLabel = TextLabel(fontSm, "Press Backspace to go back to the main menu.", textColor,
+                          {100, 0});
+}
 
-  const std::string objective3Text = "3. Collect the green squares to gain a speed boost.";
-  const Vec2        objective3Pos  = objective2Pos + Vec2{0, 40};
-  TextHelpers::renderLineOfText(renderer, fontSm, objective3Text, textColor, objective3Pos);
+void HowToPlayScene::renderText() {
+  SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
+  FontManager  &fonts    = m_gameEngine->getFontManager();
 
-  const std::string objective4Text = "4. Avoid purple squares as they will slow you down.";
-  const Vec2        objective4Pos  = objective3Pos + Vec2{0, 40};
-  TextHelpers::renderLineOfText(renderer, fontSm, objective4Text, textColor, objective4Pos);
+  const bool fontsLoaded = fonts.getGlyphAtlasSm() != nullptr &&
+                           fonts.getGlyphAtlasMd() != nullptr &&
+                           fonts.getGlyphAtlasLg() != nullptr;
 
-  const std::string objective5Text = "5. Shoot down red squares to increase your score.";
-  const Vec2        objective5Pos  = objective4Pos + Vec2{0, 40};
-  TextHelpers::renderLineOfText(renderer, fontSm, objective5Text, textColor, objective5Pos);
+  if (!fontsLoaded) {
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Failed to load fonts as they are null.");
+    return;
+  }
 
-  const std::string objective6Text = "6. Avoid shooting any squares you want to collect.";
-  const Vec2        objective6Pos  = objective5Pos + Vec2{0, 40};
-  TextHelpers::renderLineOfText(renderer, fontSm, objective6Text, textColor, objective6Pos);
+  for (TextLabel &label : m_labels) {
+    label.render(renderer);
+  }
 
-  // How to exit text
-  const std::string exitText   = "Press Backspace to go back to the main menu.";
-  const Vec2        windowSize = m_gameEngine->getConfigManager().getGameConfig().windowSize;
-  const Vec2        exitPos    = {100, windowSize.y - 50};
-  TextHelpers::renderLineOfText(renderer, fontSm, exitText, textColor, exitPos);
+  const Vec2 windowSize = m_gameEngine->getConfigManager().getGameConfig().windowSize;
+  m_exitLabel.setPosition({100, windowSize.y - 50});
+  m_exitLabel.render(renderer);
 }
 
 void HowToPlayScene::sDoAction(Action &action) {
@@ -1,9 +1,16 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <filesystem>
+#include <fstream>
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten/emscripten.h>
 #endif
 
+#include "../../includes/EntityManagement/EntityAccessors.hpp"
+#include "../../includes/GameEngine/GameClock.hpp"
+#include "../../includes/GameEngine/TraceRecorder.hpp"
 #include "../../includes/GameScenes/MainScene.hpp"
 #include "../../includes/GameScenes/MenuScene.hpp"
 #include "../../includes/GameScenes/ScoreScene.hpp"
@@ -13,15 +20,25 @@
 #include "../../includes/Helpers/TextHelpers.hpp"
 #include "../../includes/Helpers/Vec2.hpp"
 
-MainScene::MainScene(GameEngine *gameEngine) :
-    Scene(gameEngine) {
+MainScene::MainScene(GameEngine *gameEngine, const size_t benchmarkEntityCount) :
+    Scene(gameEngine),
+    m_lastFrameTime(GameClock::getTicks()),
+    m_broadphase(gameEngine->getConfigManager().getGameConfig().broadphase),
+    m_benchmarkEntityCount(benchmarkEntityCount) {
   SDL_Renderer        *renderer      = m_gameEngine->getVideoManager().getRenderer();
   const ConfigManager &configManager = gameEngine->getConfigManager();
 
-  m_entities = EntityManager();
-  m_player   = SpawnHelpers::MainScene::spawnPlayer(renderer, configManager, m_entities);
+  // Sprite images must be added to the atlas before this
+  m_spriteAtlas.build(renderer);
 
-  SpawnHelpers::MainScene::spawnWalls(renderer, configManager, m_entities);
+  // Headless runs have no input, so a fixed seed makes them repeat exactly
+  if (m_gameEngine->isHeadless()) {
+    m_randomGenerator.seed(configManager.getGameConfig().headlessSeed);
+  }
+
+  m_player = SpawnHelpers::MainScene::spawnPlayer(renderer, configManager, m_entities);
+
+  SpawnHelpers::MainScene::spawnWalls(renderer, configManager, m_entities, m_wallTree);
 
   // WASD
   registerAction(SDLK_w, "FORWARD");
@@ -36,40 +53,212 @@ MainScene::MainScene(GameEngine *gameEngine) :
 
   // Go to menu
   registerAction(SDLK_BACKSPACE, "GO_BACK");
+
+  // Switch between broadphase strategies to compare them in a live game
+  registerAction(SDLK_b, "CYCLE_BROADPHASE");
+
+#ifdef ENABLE_PROFILER
+  // Show per-system frame timings
+  registerAction(SDLK_F3, "TOGGLE_PROFILER");
+#endif
+
+  createLabels();
+
+  if (isBenchmarking()) {
+    spawnBenchmarkEntities();
+  }
+
+  // The first frame draws the scene as it starts
+  m_entities.update();
+  indexMovingEntities();
+  captureSnapshot(m_snapshots[m_frontSnapshot]);
 }
 
-void MainScene::update() {
-  const Uint64 currentTime = SDL_GetTicks64();
-  m_deltaTime              = static_cast<float>(currentTime - m_lastFrameTime) / 1000.0f;
+bool MainScene::isBenchmarking() const {
+  return m_benchmarkEntityCount > 0;
+}
 
-  if (!m_paused && !m_gameOver) {
-    sMovement();
-    sCollision();
-    sSpawner();
-    sLifespan();
-    sEffects();
-    sTimer();
+void MainScene::spawnBenchmarkEntities() {
+  using namespace SpawnHelpers::MainScene;
+
+  const ConfigManager   &configManager   = m_gameEngine->getConfigManager();
+  const BenchmarkConfig &benchmarkConfig = configManager.getBenchmarkConfig();
+  const Vec2            &windowSize      = configManager.getGameConfig().windowSize;
+  SDL_Renderer          *renderer        = m_gameEngine->getVideoManager().getRenderer();
+
+  m_randomGenerator.seed(benchmarkConfig.seed);
+
+  auto countFor = [this](const Uint8 percentage) -> size_t {
+    return m_benchmarkEntityCount * percentage / 100;
+  };
+
+  // Every requested entity is kept where it first lands. Checking spawn positions would cost
+  // quadratic time, and in a crowded window most spawns would be given up on.
+  constexpr bool CHECK_POSITION = false;
+
+  for (size_t i = 0; i < countFor(benchmarkConfig.enemyPercentage); i++) {
+    spawnEnemy(renderer, configManager, m_randomGenerator, m_entities, m_player,
+               CHECK_POSITION);
   }
 
+  for (size_t i = 0; i < countFor(benchmarkConfig.bulletPercentage); i++) {
+    const Vec2 target = SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
+    spawnBullets(renderer, configManager, m_entities, m_wallTree, m_player, target);
+  }
+
+  for (size_t i = 0; i < countFor(benchmarkConfig.itemPercentage); i++) {
+    spawnItem(renderer, configManager, m_randomGenerator, m_entities, m_player,
+              CHECK_POSITION);
+  }
+
+  for (size_t i = 0; i < countFor(benchmarkConfig.effectPercentage); i++) {
+    if (i % 2 == 0) {
+      spawnSpeedBoostEntity(renderer, configManager, m_randomGenerator, m_entities, m_player,
+                            CHECK_POSITION);
+    } else {
+      spawnSlownessEntity(renderer, configManager, m_randomGenerator, m_entities, m_player,
+                          CHECK_POSITION);
+    }
+  }
+
+  m_entities.update();
+
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Benchmark started with %zu entities",
+              m_entities.getEntities().size());
+}
+
+/**
+ * @brief Appends one CSV row per system to the configured output file.
+ *
+ * The header is only written to a new file, so runs at different entity counts collect in
+ * one table. Entities still leave the window or get destroyed in collisions, so each row
+ * also records how many were alive on average and at the end.
+ */
+void MainScene::writeBenchmarkReport() const {
+  const std::filesystem::path &outputPath =
+      m_gameEngine->getConfigManager().getBenchmarkConfig().outputPath;
+
+  const bool    isNewFile = !std::filesystem::exists(outputPath);
+  std::ofstream output(outputPath, std::ios::app);
+
+  if (!output.is_open()) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to open benchmark output: %s",
+                 outputPath.c_str());
+    throw std::runtime_error("Failed to open benchmark output");
+  }
+
+  if (isNewFile) {
+    output << "entities,ticks,mean_live_entities,final_live_entities,system,calls,total_ms,"
+              "mean_us,max_us\n";
+  }
+
+  const double meanLiveEntities =
+      m_benchmarkTicks == 0 ? 0.0
+                            : static_cast<double>(m_benchmarkLiveEntityTotal) /
+                                  static_cast<double>(m_benchmarkTicks);
+  const size_t finalLiveEntities = m_entities.getEntities().size();
+
+  const SystemTimer &systemTimer = m_gameEngine->getSystemTimer();
+  for (const auto &[name, calls, totalTicks, maxTicks] : systemTimer.getTimings()) {
+    const double totalMicroseconds = SystemTimer::toMicroseconds(totalTicks);
+
+    output << m_benchmarkEntityCount << ',' << m_benchmarkTicks << ',' << meanLiveEntities
+           << ',' << finalLiveEntities << ',' << name << ',' << calls << ','
+           << totalMicroseconds / 1000.0 << ','
+           << totalMicroseconds / static_cast<double>(calls) << ','
+           << SystemTimer::toMicroseconds(maxTicks) << '\n';
+  }
+
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Benchmark results written to %s",
+              outputPath.c_str());
+}
+
+void MainScene::update() {
+  const Uint64 currentTime = GameClock::getTicks();
+  const float  frameTime   = static_cast<float>(currentTime - m_lastFrameTime) / 1000.0f;
+
+  // Apply changes made outside the simulation, such as bullets fired or walls respawned on
+  // resize
+  const bool entitiesChanged = m_entities.hasPendingChanges();
+  m_entities.update();
+
+  // Present last frame's snapshot while the simulation advances and captures the next one.
+  // Only the worker touches the entities until it is done.
+  m_simulationThread.start([this, frameTime, entitiesChanged]() -> void {
+    simulate(frameTime, entitiesChanged);
+  });
+  m_gameEngine->getSystemTimer().measure("sRender", [this]() -> void { sRender(); });
+  m_simulationThread.wait();
+  m_frontSnapshot = 1 - m_frontSnapshot;
+
   sAudio();
-  sRender();
   m_lastFrameTime = currentTime;
 
+  const Uint64 benchmarkTicks = m_gameEngine->getConfigManager().getBenchmarkConfig().ticks;
+  if (isBenchmarking() && m_benchmarkTicks >= benchmarkTicks) {
+    writeBenchmarkReport();
+    m_gameEngine->quit();
+    return;
+  }
+
   if (m_endTriggered) {
     onEnd();
   }
 }
 
+void MainScene::simulate(const float frameTime, const bool entitiesChanged) {
+  const GameConfig &gameConfig  = m_gameEngine->getConfigManager().getGameConfig();
+  SystemTimer      &systemTimer = m_gameEngine->getSystemTimer();
+
+  // The simulation always advances in steps of the configured tick rate, independent of how
+  // often frames are drawn
+  const float stepDuration = 1.0f / static_cast<float>(gameConfig.tickRate);
+  m_deltaTime              = stepDuration;
+
+  Uint32 steps = 0;
+  if (!m_paused && !m_gameOver) {
+    // Headless frames stand for exactly one step, so a run of N frames is N steps
+    steps = m_gameEngine->isHeadless()
+                ? 1
+                : takeFixedSteps(frameTime, stepDuration, gameConfig.maxStepsPerFrame);
+
+    for (Uint32 step = 0; step < steps && !m_gameOver; step++) {
+      systemTimer.measure("sMovement", [this]() -> void { sMovement(); });
+      systemTimer.measure("sCollision", [this]() -> void { sCollision(); });
+      systemTimer.measure("sSpawner", [this]() -> void { sSpawner(); });
+      systemTimer.measure("sLifespan", [this]() -> void { sLifespan(); });
+      systemTimer.measure("sEffects", [this]() -> void { sEffects(); });
+
+      // Apply the spawns and removals queued by this step's systems before the next one
+      m_entities.update();
+      m_benchmarkTicks++;
+      m_benchmarkLiveEntityTotal += m_entities.getEntities().size();
+    }
+
+    sTimer();
+  }
+
+  // The snapshot culls through the broadphase index, so it must hold every entity where it
+  // is now. Collision responses and flushes leave it behind, but a frame that neither steps
+  // nor adds or removes entities can keep the index from the last pass.
+  if (steps > 0 || entitiesChanged) {
+    systemTimer.measure("sIndex", [this]() -> void { indexMovingEntities(); });
+  }
+
+  RenderSnapshot &snapshot = m_snapshots[1 - m_frontSnapshot];
+  systemTimer.measure("sSnapshot", [this, &snapshot]() -> void { captureSnapshot(snapshot); });
+}
+
 void MainScene::sDoAction(Action &action) {
-  if (m_player == nullptr) {
-    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Player entity is null, cannot process action.");
+  if (!m_player.isValid()) {
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Player entity is invalid, cannot process action.");
     return;
   }
 
   const ActionState &actionState      = action.getState();
   AudioSampleQueue  &audioSampleQueue = m_gameEngine->getAudioSampleQueue();
 
-  const auto &cInput = m_player->getComponent<CInput>();
+  const auto &cInput = m_player.getComponent<CInput>();
 
   if (cInput == nullptr) {
     SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Player entity lacks an input component.");
@@ -100,7 +289,7 @@ void MainScene::sDoAction(Action &action) {
     return;
   }
   if (action.getName() == "SHOOT") {
-    const auto currentTime = SDL_GetTicks64();
+    const auto currentTime = GameClock::getTicks();
     const auto spawnBullet = currentTime - m_lastBulletSpawnTime > m_bulletSpawnCooldown;
     if (!spawnBullet) {
       return;
@@ -116,7 +305,7 @@ void MainScene::sDoAction(Action &action) {
     audioSampleQueue.queueSample(AudioSample::SHOOT, AudioSamplePriority::STANDARD);
     SpawnHelpers::MainScene::spawnBullets(m_gameEngine->getVideoManager().getRenderer(),
                                           m_gameEngine->getConfigManager(), m_entities,
-                                          m_player, mousePosition);
+                                          m_wallTree, m_player, mousePosition);
     m_lastBulletSpawnTime = currentTime;
 
     if (action.getName() == "PAUSE") {
@@ -129,79 +318,224 @@ void MainScene::sDoAction(Action &action) {
     audioSampleQueue.queueSample(AudioSample::MENU_SELECT, AudioSamplePriority::CRITICAL);
     m_endTriggered = true;
   }
+
+  if (action.getName() == "CYCLE_BROADPHASE") {
+    m_broadphase.cycleType();
+  }
+
+#ifdef ENABLE_PROFILER
+  if (action.getName() == "TOGGLE_PROFILER") {
+    m_gameEngine->getFrameProfiler().toggleVisible();
+  }
+#endif
 }
 
-void MainScene::renderText() const {
+void MainScene::createLabels() {
+  const GlyphAtlas *fontSm = m_gameEngine->getFontManager().getGlyphAtlasSm();
+  const GlyphAtlas *fontMd = m_gameEngine->getFontManager().getGlyphAtlasMd();
+
+  constexpr SDL_Color textColor       = {255, 255, 255, 255};
+  constexpr SDL_Color speedBoostColor = {0, 255, 0, 255};
+  constexpr SDL_Color slownessColor   = {255, 0, 0, 255};
+
+  // The HUD values are filled in when rendering
+  m_scoreLabel = TextLabel(fontMd, "", textColor, {10, 10});
+  m_livesLabel = TextLabel(fontMd, "", textColor, {10, 40});
+  m_timeLabel  = TextLabel(fontMd, "", textColor, {10, 70});
+
+  m_speedBoostLabel = TextLabel(fontSm, "Speed Boost Active!", speedBoostColor, {10, 120});
+  m_slownessLabel   = TextLabel(fontSm, "Slowness Active!", slownessColor, {10, 120});
+}
+
+void MainScene::renderText(const RenderSnapshot &snapshot) {
   SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
-  TTF_Font     *fontSm   = m_gameEngine->getFontManager().getFontSm();
-  TTF_Font     *fontMd   = m_gameEngine->getFontManager().getFontMd();
-
-  constexpr SDL_Color scoreColor = {255, 255, 255, 255};
-  const std::string   scoreText  = "Score: " + std::to_string(m_score);
-  const Vec2          scorePos   = {10, 10};
-  TextHelpers::renderLineOfText(renderer, fontMd, scoreText, scoreColor, scorePos);
-
-  constexpr SDL_Color livesColor = {255, 255, 255, 255};
-  const std::string   livesText  = "Lives: " + std::to_string(m_lives);
-  const Vec2          livesPos   = {10, 40};
-  TextHelpers::renderLineOfText(renderer, fontMd, livesText, livesColor, livesPos);
-
-  const Uint64        timeRemaining = m_timeRemaining;
-  const Uint64        minutes       = timeRemaining / 60000;
-  const Uint64        seconds       = timeRemaining % 60000 / 1000;
-  constexpr SDL_Color timeColor     = {255, 255, 255, 255};
-  const std::string   timeText      = "Time: " + std::to_string(minutes) + ":" +
+
+  // Labels only rasterize again when their text changes, which for the timer is once a second
+  m_scoreLabel.setText("Score: " + std::to_string(snapshot.score));
+  m_scoreLabel.render(renderer);
+
+  m_livesLabel.setText("Lives: " + std::to_string(snapshot.lives));
+  m_livesLabel.render(renderer);
+
+  const Uint64      timeRemaining = snapshot.timeRemaining;
+  const Uint64      minutes       = timeRemaining / 60000;
+  const Uint64      seconds       = timeRemaining % 60000 / 1000;
+  const std::string timeText      = "Time: " + std::to_string(minutes) + ":" +
                                (seconds < 10 ? "0" : "") + std::to_string(seconds);
-  const Vec2 timePos = {10, 70};
+  m_timeLabel.setText(timeText);
+  m_timeLabel.render(renderer);
 
-  TextHelpers::renderLineOfText(renderer, fontMd, timeText, timeColor, timePos);
+  if (snapshot.speedBoost) {
+    m_speedBoostLabel.render(renderer);
+  }
+
+  if (snapshot.slowness) {
+    m_slownessLabel.render(renderer);
+  }
+}
+
+#ifdef ENABLE_PROFILER
+void MainScene::renderProfilerOverlay(const RenderSnapshot &snapshot) const {
+  FrameProfiler &frameProfiler = m_gameEngine->getFrameProfiler();
+  if (!frameProfiler.isVisible()) {
+    return;
+  }
+
+  SDL_Renderer     *renderer   = m_gameEngine->getVideoManager().getRenderer();
+  const GlyphAtlas *fontSm     = m_gameEngine->getFontManager().getGlyphAtlasSm();
+  const Vec2       &windowSize = m_gameEngine->getConfigManager().getGameConfig().windowSize;
+
+  constexpr SDL_Color overlayColor = {255, 255, 0, 255};
+  constexpr float     lineHeight   = 26;
+  const float         left         = windowSize.x - 600;
+  float               top          = 10;
+
+  auto formatMicroseconds = [](const double microseconds) -> std::string {
+    return std::to_string(static_cast<int>(std::lround(microseconds)));
+  };
 
-  const auto cEffects = m_player->getComponent<CEffects>();
+  TextHelpers::renderLineOfText(renderer, fontSm, "system min/avg/p99 us", overlayColor,
+                                {left, top});
+  top += lineHeight;
 
-  if (cEffects->hasEffect(EffectTypes::Speed)) {
-    constexpr SDL_Color speedBoostColor = {0, 255, 0, 255};
-    const std::string   speedBoostText  = "Speed Boost Active!";
-    const Vec2          speedBoostPos   = {10, 120};
-    TextHelpers::renderLineOfText(renderer, fontSm, speedBoostText, speedBoostColor,
-                                  speedBoostPos);
+  for (const auto &[name, minimum, average, p99] : frameProfiler.computeStats()) {
+    const std::string line = name + " " + formatMicroseconds(minimum) + "/" +
+                             formatMicroseconds(average) + "/" + formatMicroseconds(p99);
+    TextHelpers::renderLineOfText(renderer, fontSm, line, overlayColor, {left, top});
+    top += lineHeight;
   }
 
-  if (cEffects->hasEffect(EffectTypes::Slowness)) {
-    constexpr SDL_Color slownessColor = {255, 0, 0, 255};
-    const std::string   slownessText  = "Slowness Active!";
-    const Vec2          slownessPos   = {10, 120};
-    TextHelpers::renderLineOfText(renderer, fontSm, slownessText, slownessColor, slownessPos);
+  for (size_t tag = 0; tag < ENTITY_TAG_COUNT; tag++) {
+    const size_t count = snapshot.tagCounts[tag];
+    if (count == 0) {
+      continue;
+    }
+
+    const std::string line =
+        std::string(getTagName(static_cast<EntityTags>(tag))) + " " + std::to_string(count);
+    TextHelpers::renderLineOfText(renderer, fontSm, line, overlayColor, {left, top});
+    top += lineHeight;
   }
 }
+#endif
 
 void MainScene::sRender() {
-  SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
+  const RenderSnapshot &snapshot = m_snapshots[m_frontSnapshot];
+  SDL_Renderer         *renderer = m_gameEngine->getVideoManager().getRenderer();
   SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
   SDL_RenderClear(renderer);
 
-  for (const auto &entity : m_entities.getEntities()) {
+  snapshot.sprites.submit(renderer, m_spriteAtlas.getTexture());
+
+  renderText(snapshot);
+#ifdef ENABLE_PROFILER
+  renderProfilerOverlay(snapshot);
+#endif
+  // Update the screen
+  TraceRecorder::begin("SDL_RenderPresent");
+  SDL_RenderPresent(renderer);
+  TraceRecorder::end("SDL_RenderPresent");
+}
+
+void MainScene::indexMovingEntities() {
+  // Walls never move, so they stay in the wall tree instead
+  m_movingEntities.clear();
+  for (const Entity &entity : m_entities.getEntities()) {
+    if (entity.tag() != EntityTags::Wall) {
+      m_movingEntities.push_back(entity);
+    }
+  }
+
+  m_broadphase.update(m_movingEntities);
+}
+
+void MainScene::followPlayer() {
+  if (!m_player.isActive()) {
+    return;
+  }
+
+  VideoManager     &videoManager = m_gameEngine->getVideoManager();
+  const Vec2       &worldSize    = m_gameEngine->getConfigManager().getGameConfig().windowSize;
+  const BoundingBox view         = videoManager.getCameraBounds();
+  const Vec2        viewSize     = view.max - view.min;
+
+  // Center the player, but never show past the edges of the world. The world is still the
+  // size of the window, so for now this keeps the camera at the origin.
+  auto clampToWorld = [](const float position, const float viewLength,
+                         const float worldLength) -> float {
+    return std::clamp(position, 0.0f, std::max(worldLength - viewLength, 0.0f));
+  };
+
+  const Vec2 centered = m_player.getCenterPos() - viewSize * 0.5f;
+  videoManager.setCameraPosition({clampToWorld(centered.x, viewSize.x, worldSize.x),
+                                  clampToWorld(centered.y, viewSize.y, worldSize.y)});
+}
+
+void MainScene::captureSnapshot(RenderSnapshot &snapshot) {
+  followPlayer();
+
+  const VideoManager &videoManager = m_gameEngine->getVideoManager();
+  const Uint64        currentTime  = GameClock::getTicks();
+  const Vec2         &camera       = videoManager.getCameraPosition();
+  const BoundingBox   cameraBounds = videoManager.getCameraBounds();
+
+  // Only entities near the camera are looked at, through the same indices collision uses.
+  // The broadphase was brought up to date by simulate, and its swept boxes cover every
+  // interpolated position.
+  m_visibleEntities.clear();
+  m_wallTree.query(cameraBounds, m_visibleEntities);
+  m_broadphase.query(cameraBounds, m_movingEntities, m_visibleEntities);
+
+  // Shapes and sprites share one atlas, so every entity is drawn with a single call
+  snapshot.sprites.clear();
+  for (const Entity &entity : m_visibleEntities) {
+    const CShape     *cShape     = entity.getComponent<CShape>();
+    const CTransform *cTransform = entity.getComponent<CTransform>();
+    const CSprite    *cSprite    = entity.getComponent<CSprite>();
+
+    // Entities without a shape are never indexed
+    if (cShape == nullptr || cTransform == nullptr) {
+      continue;
+    }
 
-    const auto &cShape     = entity->getComponent<CShape>();
-    const auto &cTransform = entity->getComponent<CTransform>();
+    // Draw between the last two simulation steps, so motion stays smooth when the refresh
+    // rate and the tick rate differ
+    const Vec2 &previousPos = cTransform->previousTopLeftCornerPos;
+    const Vec2 &currentPos  = cTransform->topLeftCornerPos;
+    const Vec2  pos         = previousPos + (currentPos - previousPos) * m_interpolation;
 
-    if (cShape == nullptr) {
+    const Vec2        size   = {static_cast<float>(cShape->rect.w),
+                                static_cast<float>(cShape->rect.h)};
+    const BoundingBox bounds = {.min = pos, .max = pos + size};
+    if (!bounds.overlaps(cameraBounds)) {
       continue;
     }
 
-    SDL_Rect   &rect = cShape->rect;
-    const Vec2 &pos  = cTransform->topLeftCornerPos;
+    const SDL_FRect destination = {.x = std::floor(pos.x - camera.x),
+                                   .y = std::floor(pos.y - camera.y),
+                                   .w = size.x,
+                                   .h = size.y};
+    const size_t    region      = cSprite ? cSprite->region : SpriteAtlas::SOLID_REGION;
 
-    rect.x = static_cast<int>(pos.x);
-    rect.y = static_cast<int>(pos.y);
+    SDL_Color color = cShape->color;
+    color.a         = calculateFadedAlpha(entity, color.a, currentTime);
 
-    const auto &[r, g, b, a] = cShape->color;
-    SDL_SetRenderDrawColor(renderer, r, g, b, a);
-    SDL_RenderFillRect(renderer, &rect);
+    snapshot.sprites.add(destination, m_spriteAtlas.getRegion(region), color);
   }
 
-  renderText();
-  // Update the screen
-  SDL_RenderPresent(renderer);
+  const CEffects *cEffects = m_player.getComponent<CEffects>();
+
+  snapshot.score         = m_score;
+  snapshot.lives         = m_lives;
+  snapshot.timeRemaining = m_timeRemaining;
+  snapshot.speedBoost    = cEffects != nullptr && cEffects->hasEffect(EffectTypes::Speed);
+  snapshot.slowness      = cEffects != nullptr && cEffects->hasEffect(EffectTypes::Slowness);
+
+#ifdef ENABLE_PROFILER
+  for (size_t tag = 0; tag < ENTITY_TAG_COUNT; tag++) {
+    snapshot.tagCounts[tag] = m_entities.getEntities(static_cast<EntityTags>(tag)).size();
+  }
+#endif
 }
 
 void MainScene::sCollision() {
@@ -217,41 +551,134 @@ void MainScene::sCollision() {
                  .score              = m_score,
                  .setScore           = [this](const int score) -> void { setScore(score); },
                  .decrementLives     = [this]() -> void { decrementLives(); },
-                 .windowSize         = windowSize,
-                 .audioSampleManager = audioSampleManager};
+                 .audioSampleManager = audioSampleManager,
+                 .windowSize         = windowSize};
 
-  for (auto &entity : m_entities.getEntities()) {
+  const EntitySpan entities = m_entities.getEntities();
+  for (const auto &entity : entities) {
     handleEntityBounds(entity, windowSize);
-    for (auto &otherEntity : m_entities.getEntities()) {
-      const CollisionPair collisionPair = {.entityA = entity, .entityB = otherEntity};
-      handleEntityEntityCollision(collisionPair, gameState);
+  }
+
+  // Walls never move, so they stay out of the broadphase. Everything else looks up the walls
+  // it touches in the wall tree. Walls have no responses of their own, so one order suffices.
+  m_movingEntities.clear();
+  for (const auto &entity : entities) {
+    if (entity.tag() == EntityTags::Wall) {
+      continue;
+    }
+    m_movingEntities.push_back(entity);
+
+    const std::optional<BoundingBox> box = CollisionHelpers::calculateSweptBoundingBox(entity);
+    if (!box.has_value()) {
+      continue;
+    }
+
+    m_nearbyWalls.clear();
+    m_wallTree.query(*box, m_nearbyWalls);
+    for (const Entity &wall : m_nearbyWalls) {
+      const Vec2 overlap = CollisionHelpers::calculateOverlap(entity, wall);
+      handleEntityEntityCollision({.entityA = entity, .entityB = wall, .overlap = overlap},
+                                  gameState);
     }
   }
 
-  m_entities.update();
+  m_broadphase.update(m_movingEntities);
+  const std::vector<CandidatePair> &pairs = m_broadphase.findCandidatePairs();
+  m_overlapKernel.load(m_movingEntities);
+
+  // Resolves one candidate with the overlap the kernel computed for it, and returns whether a
+  // response ran. Responses may move either entity, so both are packed again afterwards.
+  auto resolveCandidate = [this, &gameState](const size_t indexA, const size_t indexB,
+                                             Vec2 overlap) -> bool {
+    const Entity &entityA = m_movingEntities[indexA];
+    const Entity &entityB = m_movingEntities[indexB];
+
+    const bool mayCollide = (overlap.x > 0 && overlap.y > 0) ||
+                            usesContinuousCollision(entityA) ||
+                            usesContinuousCollision(entityB);
+    if (!mayCollide) {
+      return false;
+    }
+
+    auto repack = [this, indexA, indexB, &entityA, &entityB]() -> void {
+      m_overlapKernel.update(indexA, entityA);
+      m_overlapKernel.update(indexB, entityB);
+    };
+
+    // The broadphase reports each unordered pair once. Responses are keyed on
+    // (tag, otherTag), so each candidate is resolved in both orders.
+    bool responded = handleEntityEntityCollision(
+        {.entityA = entityA, .entityB = entityB, .overlap = overlap}, gameState);
+    if (responded) {
+      repack();
+      overlap = m_overlapKernel.computeOverlap(indexB, indexA);
+    }
+
+    if (handleEntityEntityCollision(
+            {.entityA = entityB, .entityB = entityA, .overlap = overlap}, gameState)) {
+      repack();
+      responded = true;
+    }
+
+    return responded;
+  };
+
+  // Pairs are sorted by their first entity, so each run of pairs sharing it is tested against
+  // the overlap kernel in one batch, and the narrowphase reuses the kernel's overlaps. Once a
+  // response moves an entity, the rest of the run is computed again from the new positions.
+  for (size_t first = 0; first < pairs.size();) {
+    const size_t indexA = pairs[first].indexA;
+    size_t       last   = first;
+    while (last < pairs.size() && pairs[last].indexA == indexA) {
+      last++;
+    }
+
+    size_t next = first;
+    while (next < last) {
+      const std::span<const CandidatePair> batch(pairs.data() + next, last - next);
+      m_overlapKernel.computeOverlaps(indexA, batch);
+
+      bool   responded = false;
+      size_t candidate = 0;
+      while (candidate < batch.size() && !responded) {
+        responded = resolveCandidate(indexA, batch[candidate].indexB,
+                                     m_overlapKernel.getOverlap(candidate));
+        candidate++;
+      }
+      next += candidate;
+    }
+
+    first = last;
+  }
 }
 
 void MainScene::sMovement() {
-  const ConfigManager        &configManager          = m_gameEngine->getConfigManager();
-  const PlayerConfig         &playerConfig           = configManager.getPlayerConfig();
-  const EnemyConfig          &enemyConfig            = configManager.getEnemyConfig();
-  const SlownessEffectConfig &slownessEffectConfig   = configManager.getSlownessEffectConfig();
-  const SpeedEffectConfig    &speedBoostEffectConfig = configManager.getSpeedEffectConfig();
+  const PlayerConfig &playerConfig = m_gameEngine->getConfigManager().getPlayerConfig();
+
+  // Collision checks sweep each entity from where it starts this step
+  for (const Entity &entity : m_entities.view<CTransform>()) {
+    CTransform *cTransform               = entity.getComponent<CTransform>();
+    cTransform->previousTopLeftCornerPos = cTransform->topLeftCornerPos;
+  }
 
-  for (const std::shared_ptr<Entity> &entity : m_entities.getEntities()) {
-    MovementHelpers::moveSpeedBoosts(entity, speedBoostEffectConfig, m_deltaTime);
-    MovementHelpers::moveEnemies(entity, enemyConfig, m_deltaTime);
+  // Each kind of movement has its own component, so every loop runs one helper
+  for (const Entity &entity : m_entities.view<CTransform, CInput>()) {
     MovementHelpers::movePlayer(entity, playerConfig, m_deltaTime);
-    MovementHelpers::moveSlownessDebuffs(entity, slownessEffectConfig, m_deltaTime);
-    MovementHelpers::moveBullets(entity, m_deltaTime);
-    MovementHelpers::moveItems(entity, m_deltaTime);
+  }
+
+  for (const Entity &entity : m_entities.view<CTransform, CLinearMovement>()) {
+    MovementHelpers::moveLinear(entity, m_deltaTime);
+  }
+
+  for (const Entity &entity : m_entities.view<CTransform, CDriftMovement>()) {
+    MovementHelpers::moveDrifting(entity, m_deltaTime);
   }
 }
 
 void MainScene::sSpawner() {
   const ConfigManager &configManager  = m_gameEngine->getConfigManager();
   SDL_Renderer        *renderer       = m_gameEngine->getVideoManager().getRenderer();
-  const Uint64         ticks          = SDL_GetTicks64();
+  const Uint64         ticks          = GameClock::getTicks();
   const Uint64         SPAWN_INTERVAL = configManager.getGameConfig().spawnInterval;
 
   if (ticks - m_lastNonPlayerEntitySpawnTime < SPAWN_INTERVAL) {
@@ -264,7 +691,7 @@ void MainScene::sSpawner() {
   const SlownessEffectConfig &slownessEffectConfig   = configManager.getSlownessEffectConfig();
   const ItemConfig           &itemConfig             = configManager.getItemConfig();
 
-  const auto &cEffects = m_player->getComponent<CEffects>();
+  const auto &cEffects = m_player.getComponent<CEffects>();
   const bool  hasSpeedBasedEffect =
       cEffects->hasEffect(EffectTypes::Speed) || cEffects->hasEffect(EffectTypes::Slowness);
 
@@ -295,12 +722,12 @@ void MainScene::sSpawner() {
 
   if (decisions.speedBoost) {
     SpawnHelpers::MainScene::spawnSpeedBoostEntity(renderer, configManager, m_randomGenerator,
-                                                   m_entities, m_player);
+                                                   m_entities,              m_player);
   }
 
   if (decisions.slowness) {
     SpawnHelpers::MainScene::spawnSlownessEntity(renderer, configManager, m_randomGenerator,
-                                                 m_entities, m_player);
+                                                 m_entities,              m_player);
   }
 
   if (decisions.item) {
@@ -311,13 +738,13 @@ void MainScene::sSpawner() {
 
 void MainScene::sEffects() const {
 
-  const auto               &cEffects = m_player->getComponent<CEffects>();
+  const auto               &cEffects = m_player.getComponent<CEffects>();
   const std::vector<Effect> effects  = cEffects->getEffects();
   if (effects.empty()) {
     return;
   }
 
-  const Uint64 currentTime = SDL_GetTicks64();
+  const Uint64 currentTime = GameClock::getTicks();
   for (const auto &[startTime, duration, type] : effects) {
     const bool effectExpired = currentTime - startTime > duration;
     if (!effectExpired) {
@@ -329,7 +756,7 @@ void MainScene::sEffects() const {
 }
 
 void MainScene::sTimer() {
-  const Uint64 currentTime = SDL_GetTicks64();
+  const Uint64 currentTime = GameClock::getTicks();
 
   // Check if the timer was recently operated by comparing the current time
   // with the last frame time and the scene's start time.
@@ -346,59 +773,39 @@ void MainScene::sTimer() {
 }
 
 void MainScene::sLifespan() {
-  for (const auto &entity : m_entities.getEntities()) {
-    const auto tag = entity->tag();
-    if (tag == EntityTags::Player) {
-      continue;
-    }
-    if (tag == EntityTags::Wall) {
-      continue;
+  // Players and walls have no lifespan component, so the view skips them.
+  for (const Entity &entity : m_entities.view<CLifespan>()) {
+    const CLifespan *cLifespan = entity.getComponent<CLifespan>();
+
+    // Benchmarks keep their population, so expiry is checked but not applied
+    const Uint64 elapsedTime = GameClock::getTicks() - cLifespan->birthTime;
+    if (elapsedTime > cLifespan->lifespan && !isBenchmarking()) {
+      entity.destroy();
     }
+  }
+}
 
-    const auto &cLifespan = entity->getComponent<CLifespan>();
-
-    const auto &cShape = entity->getComponent<CShape>();
-    if (cLifespan == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_ERROR,
-                   "Entity with ID %zu and tag %d lacks a lifespan component.", entity->id(),
-                   tag);
-      continue;
-    }
-
-    if (cShape == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_ERROR,
-                   "Entity with ID %zu and tag %d lacks a shape component.", entity->id(),
-                   tag);
-      continue;
-    }
-
-    const Uint64 currentTime = SDL_GetTicks();
-    const Uint64 elapsedTime = currentTime - cLifespan->birthTime;
-    // Calculate the lifespan percentage, ensuring it's clamped between 0 and 1
-    const float lifespanPercentage = std::min(
-        1.0f, static_cast<float>(elapsedTime) / static_cast<float>(cLifespan->lifespan));
-
-    const bool entityExpired = elapsedTime > cLifespan->lifespan;
-    if (!entityExpired && entity->tag() == EntityTags::Enemy) {
-      continue;
-    }
-    if (!entityExpired) {
-      constexpr float MAX_COLOR_VALUE = 255.0f;
-      const Uint8     alpha           = static_cast<Uint8>(std::max(
-          0.0f, std::min(MAX_COLOR_VALUE, MAX_COLOR_VALUE * (1.0f - lifespanPercentage))));
+Uint8 MainScene::calculateFadedAlpha(const Entity &entity,
+                                     const Uint8   alpha,
+                                     const Uint64  currentTime) {
+  const CLifespan *cLifespan = entity.getComponent<CLifespan>();
 
-      SDL_Color &color = cShape->color;
-      color            = {.r = color.r, .g = color.g, .b = color.b, .a = alpha};
+  // Enemies stay opaque until they expire
+  if (cLifespan == nullptr || entity.tag() == EntityTags::Enemy) {
+    return alpha;
+  }
 
-      continue;
-    }
+  const Uint64 elapsedTime = currentTime - cLifespan->birthTime;
+  // Calculate the lifespan percentage, ensuring it's clamped between 0 and 1
+  const float lifespanPercentage = std::min(
+      1.0f, static_cast<float>(elapsedTime) / static_cast<float>(cLifespan->lifespan));
 
-    entity->destroy();
-  }
+  return static_cast<Uint8>(static_cast<float>(alpha) * (1.0f - lifespanPercentage));
 }
 
 void MainScene::setGameOver() {
-  if (m_gameOver) {
+  // Benchmarks always run for their full tick count
+  if (m_gameOver || isBenchmarking()) {
     return;
   }
   m_gameOver     = true;
@@ -445,13 +852,11 @@ void MainScene::sAudio() {
 }
 
 void MainScene::onSceneWindowResize() {
-  const auto walls = m_entities.getEntities(EntityTags::Wall);
-  for (const auto &wall : walls) {
-    wall->destroy();
+  for (const Entity &wall : m_entities.getEntities(EntityTags::Wall)) {
+    wall.destroy();
   }
 
-  m_entities.update();
-
   SpawnHelpers::MainScene::spawnWalls(m_gameEngine->getVideoManager().getRenderer(),
-                                      m_gameEngine->getConfigManager(), m_entities);
+                                      m_gameEngine->getConfigManager(), m_entities,
+                                      m_wallTree);
 }
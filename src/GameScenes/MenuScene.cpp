@@ -1,7 +1,6 @@
 #include "../../includes/GameScenes/MenuScene.hpp"
 #include "../../includes/GameScenes/HowToPlayScene.hpp"
 #include "../../includes/GameScenes/MainScene.hpp"
-#include "../../includes/Helpers/TextHelpers.hpp"
 
 #include <SDL2/SDL.h>
 
@@ -11,6 +10,8 @@ MenuScene::MenuScene(GameEngine *gameEngine) :
   registerAction(SDLK_RETURN, "SELECT");
   registerAction(SDLK_w, "UP");
   registerAction(SDLK_s, "DOWN");
+
+  createLabels();
 }
 
 void MenuScene::update() {
@@ -38,52 +39,74 @@ void MenuScene::onEnd() {
 
 void MenuScene::sRender() {
   SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
-  SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-  SDL_RenderClear(renderer);
-  renderText();
+
+  // The text is only drawn again after something on screen changed
+  m_frame.render(renderer, [this, renderer]() -> void {
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderClear(renderer);
+    renderText();
+  });
   SDL_RenderPresent(renderer);
 }
 
-void MenuScene::renderText() const {
+void MenuScene::onSceneWindowResize() {
+  m_frame.invalidate();
+}
+
+void MenuScene::onRenderTargetsReset() {
+  m_frame.invalidate();
+}
+
+void MenuScene::createLabels() {
+  const GlyphAtlas   *fontLg    = m_gameEngine->getFontManager().getGlyphAtlasLg();
+  const GlyphAtlas   *fontMd    = m_gameEngine->getFontManager().getGlyphAtlasMd();
+  const GlyphAtlas   *fontSm    = m_gameEngine->getFontManager().getGlyphAtlasSm();
+  constexpr SDL_Color textColor = {255, 255, 255, 255};
+
+  const Vec2 titlePos = {100, 100};
+  m_titleLabel        = TextLabel(fontLg, "Yerb's Game", textColor, titlePos);
+
+  const Vec2 playPos = titlePos + Vec2{0, 100};
+  m_optionLabels.emplace_back(fontMd, "Play", textColor, playPos);
+
+  const Vec2 instructionsPos = playPos + Vec2{0, 50};
+  m_optionLabels.emplace_back(fontMd, "How to Play", textColor, instructionsPos);
+
+#ifndef __EMSCRIPTEN__
+  const Vec2 quitPos = instructionsPos + Vec2{0, 50};
+  m_optionLabels.emplace_back(fontMd, "Quit", textColor, quitPos);
+#endif
+
+  // Positioned every frame to stay at the bottom of the window
+  m_controlsLabel = TextLabel(fontSm, "W/S to move up/down, Enter to select", textColor, {});
+}
+
+void MenuScene::renderText() {
   SDL_Renderer *renderer      = m_gameEngine->getVideoManager().getRenderer();
-  TTF_Font     *fontLg        = m_gameEngine->getFontManager().getFontLg();
-  TTF_Font     *fontMd        = m_gameEngine->getFontManager().getFontMd();
-  TTF_Font     *fontSm        = m_gameEngine->getFontManager().getFontSm();
+  FontManager  &fonts         = m_gameEngine->getFontManager();
   SDL_Color     textColor     = {255, 255, 255, 255};
   SDL_Color     selectedColor = {0, 255, 0, 255};
 
-  if (fontLg == nullptr || fontMd == nullptr || fontSm == nullptr) {
+  if (fonts.getGlyphAtlasLg() == nullptr || fonts.getGlyphAtlasMd() == nullptr ||
+      fonts.getGlyphAtlasSm() == nullptr) {
     SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Failed to load fonts as they are null.");
     return;
   }
 
-  const std::string titleText = "Yerb's Game";
-  const Vec2        titlePos  = {100, 100};
-  TextHelpers::renderLineOfText(renderer, fontLg, titleText, textColor, titlePos);
+  m_titleLabel.render(renderer);
 
-  const std::string playText  = "Play";
-  const Vec2        playPos   = titlePos + Vec2{0, 100};
-  const SDL_Color   playColor = m_selectedIndex == 0 ? selectedColor : textColor;
-  TextHelpers::renderLineOfText(renderer, fontMd, playText, playColor, playPos);
-
-  const std::string instructionsText  = "How to Play";
-  const Vec2        instructionsPos   = playPos + Vec2{0, 50};
-  const SDL_Color   instructionsColor = m_selectedIndex == 1 ? selectedColor : textColor;
-  TextHelpers::renderLineOfText(renderer, fontMd, instructionsText, instructionsColor,
-                                instructionsPos);
-
-#ifndef __EMSCRIPTEN__
-  const std::string quitText  = "Quit";
-  const Vec2        quitPos   = instructionsPos + Vec2{0, 50};
-  const SDL_Color   quitColor = m_selectedIndex == 2 ? selectedColor : textColor;
-  TextHelpers::renderLineOfText(renderer, fontMd, quitText, quitColor, quitPos);
-#endif
+  // Highlighting an option only changes its color, so it never rasterizes again
+  for (size_t index = 0; index < m_optionLabels.size(); index++) {
+    TextLabel &optionLabel = m_optionLabels[index];
+    optionLabel.setColor(m_selectedIndex == index ? selectedColor : textColor);
+    optionLabel.render(renderer);
+  }
 
-  const std::string controlsText = "W/S to move up/down, Enter to select";
   // bottom right corner
   const Vec2 controlsPos = {
       100, m_gameEngine->getConfigManager().getGameConfig().windowSize.y - 50};
-  TextHelpers::renderLineOfText(renderer, fontSm, controlsText, textColor, controlsPos);
+  m_controlsLabel.setPosition(controlsPos);
+  m_controlsLabel.render(renderer);
 }
 
 void MenuScene::sDoAction(Action &action) {
@@ -110,12 +133,14 @@ void MenuScene::sDoAction(Action &action) {
   if (action.getName() == "UP") {
     audioSampleQueue.queueSample(AudioSample::MENU_MOVE, AudioSamplePriority::BACKGROUND);
     m_selectedIndex > 0 ? m_selectedIndex -= 1 : m_selectedIndex = MAX_MENU_ITEMS - 1;
+    m_frame.invalidate();
     return;
   }
 
   if (action.getName() == "DOWN") {
     audioSampleQueue.queueSample(AudioSample::MENU_MOVE, AudioSamplePriority::BACKGROUND);
     m_selectedIndex < MAX_MENU_ITEMS - 1 ? m_selectedIndex += 1 : m_selectedIndex = 0;
+    m_frame.invalidate();
   }
 }
 
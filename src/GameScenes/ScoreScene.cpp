@@ -1,7 +1,6 @@
 #include "../../includes/GameScenes/ScoreScene.hpp"
 #include "../../includes/GameScenes/MainScene.hpp"
 #include "../../includes/GameScenes/MenuScene.hpp"
-#include "../../includes/Helpers/TextHelpers.hpp"
 #include <SDL2/SDL.h>
 
 ScoreScene::ScoreScene(GameEngine *gameEngine, const int score) :
@@ -10,6 +9,8 @@ ScoreScene::ScoreScene(GameEngine *gameEngine, const int score) :
   registerAction(SDLK_RETURN, "SELECT");
   registerAction(SDLK_w, "UP");
   registerAction(SDLK_s, "DOWN");
+
+  createLabels();
 }
 
 void ScoreScene::update() {
@@ -31,46 +32,68 @@ void ScoreScene::onEnd() {
 
 void ScoreScene::sRender() {
   SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
-  SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-  SDL_RenderClear(renderer);
-  renderText();
+
+  // The text is only drawn again after something on screen changed
+  m_frame.render(renderer, [this, renderer]() -> void {
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderClear(renderer);
+    renderText();
+  });
   SDL_RenderPresent(renderer);
 }
 
-void ScoreScene::renderText() const {
-  SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
-  TTF_Font     *fontLg   = m_gameEngine->getFontManager().getFontLg();
-  TTF_Font     *fontMd   = m_gameEngine->getFontManager().getFontMd();
+void ScoreScene::onSceneWindowResize() {
+  m_frame.invalidate();
+}
+
+void ScoreScene::onRenderTargetsReset() {
+  m_frame.invalidate();
+}
+
+void ScoreScene::createLabels() {
+  const GlyphAtlas *fontLg = m_gameEngine->getFontManager().getGlyphAtlasLg();
+  const GlyphAtlas *fontMd = m_gameEngine->getFontManager().getGlyphAtlasMd();
 
   constexpr SDL_Color gameOverColor = {255, 0, 0, 255};
+  constexpr SDL_Color textColor     = {255, 255, 255, 255};
+
+  const Vec2 gameOverPos = {100, 300};
+  m_gameOverLabel        = TextLabel(fontLg, "Game Over!", gameOverColor, gameOverPos);
+
+  const Vec2 scorePos = {100, 350};
+  m_scoreLabel = TextLabel(fontMd, "Score: " + std::to_string(m_score), textColor, scorePos);
+
+  // The options are positioned every frame to follow the bottom of the window
+  m_playAgainLabel = TextLabel(fontMd, "Play Again", textColor, {});
+  m_mainMenuLabel  = TextLabel(fontMd, "Main Menu", textColor, {});
+}
+
+void ScoreScene::renderText() {
+  SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
+  FontManager  &fonts    = m_gameEngine->getFontManager();
+
   constexpr SDL_Color textColor     = {255, 255, 255, 255};
   constexpr SDL_Color selectedColor = {0, 255, 0, 255};
 
-  const bool fontsLoaded = fontLg != nullptr && fontMd != nullptr;
+  const bool fontsLoaded =
+      fonts.getGlyphAtlasLg() != nullptr && fonts.getGlyphAtlasMd() != nullptr;
   if (!fontsLoaded) {
     SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Failed to load fonts as they are null.");
     return;
   }
 
-  const std::string gameOverText = "Game Over!";
-  const Vec2        gameOverPos  = {100, 300};
-  TextHelpers::renderLineOfText(renderer, fontLg, gameOverText, gameOverColor, gameOverPos);
-
-  const std::string scoreText = "Score: " + std::to_string(m_score);
-  const Vec2        scorePos  = {100, 350};
-  TextHelpers::renderLineOfText(renderer, fontMd, scoreText, textColor, scorePos);
+  m_gameOverLabel.render(renderer);
+  m_scoreLabel.render(renderer);
 
   const float bottomOfScreen = m_gameEngine->getConfigManager().getGameConfig().windowSize.y;
 
-  const std::string playAgainText  = "Play Again";
-  const Vec2        playAgainPos   = {100, bottomOfScreen - 200};
-  const SDL_Color   playAgainColor = m_selectedIndex == 0 ? selectedColor : textColor;
-  TextHelpers::renderLineOfText(renderer, fontMd, playAgainText, playAgainColor, playAgainPos);
+  m_playAgainLabel.setPosition({100, bottomOfScreen - 200});
+  m_playAgainLabel.setColor(m_selectedIndex == 0 ? selectedColor : textColor);
+  m_playAgainLabel.render(renderer);
 
-  const std::string mainMenuText  = "Main Menu";
-  const Vec2        mainMenuPos   = {100, bottomOfScreen - 150};
-  const SDL_Color   mainMenuColor = m_selectedIndex == 1 ? selectedColor : textColor;
-  TextHelpers::renderLineOfText(renderer, fontMd, mainMenuText, mainMenuColor, mainMenuPos);
+  m_mainMenuLabel.setPosition({100, bottomOfScreen - 150});
+  m_mainMenuLabel.setColor(m_selectedIndex == 1 ? selectedColor : textColor);
+  m_mainMenuLabel.render(renderer);
 }
 
 void ScoreScene::sDoAction(Action &action) {
@@ -91,12 +114,14 @@ void ScoreScene::sDoAction(Action &action) {
   if (action.getName() == "UP") {
     audioSampleQueue.queueSample(AudioSample::MENU_MOVE, AudioSamplePriority::BACKGROUND);
     m_selectedIndex > 0 ? m_selectedIndex -= 1 : m_selectedIndex = 1;
+    m_frame.invalidate();
     return;
   }
 
   if (action.getName() == "DOWN") {
     audioSampleQueue.queueSample(AudioSample::MENU_MOVE, AudioSamplePriority::BACKGROUND);
     m_selectedIndex < 1 ? m_selectedIndex += 1 : m_selectedIndex = 0;
+    m_frame.invalidate();
   }
 }
 
@@ -1,24 +1,25 @@
 #include "../../includes/Helpers/CollisionHelpers.hpp"
-#include "../../includes/EntityManagement/Entity.hpp"
+#include "../../includes/EntityManagement/EntityAccessors.hpp"
+#include "../../includes/GameEngine/GameClock.hpp"
 #include "../../includes/GameScenes/MainScene.hpp"
 #include "../../includes/Helpers/EntityHelpers.hpp"
 
 #include <bitset>
+#include <limits>
 
 enum Boundaries : Uint8 { TOP, BOTTOM, LEFT, RIGHT };
 enum RelativePosition : Uint8 { ABOVE, BELOW, LEFT_OF, RIGHT_OF };
 
 namespace CollisionHelpers {
-  std::bitset<4> detectOutOfBounds(const std::shared_ptr<Entity> &entity,
-                                   const Vec2                    &window_size) {
+  std::bitset<4> detectOutOfBounds(const Entity &entity, const Vec2 &window_size) {
 
-    const std::shared_ptr<CTransform> &cTransform = entity->getComponent<CTransform>();
-    const std::shared_ptr<CShape>     &cShape     = entity->getComponent<CShape>();
+    const CTransform *cTransform = entity.getComponent<CTransform>();
+    const CShape     *cShape     = entity.getComponent<CShape>();
 
     if (!cTransform || !cShape) {
       SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
                    "Entity with ID %zu and tag %u lacks a transform or shape component.",
-                   entity->id(), entity->tag());
+                   entity.id(), entity.tag());
 
       return {};
     }
@@ -41,23 +42,22 @@ namespace CollisionHelpers {
     return collidesWithBoundary;
   }
 
-  Vec2 calculateOverlap(const std::shared_ptr<Entity> &entityA,
-                        const std::shared_ptr<Entity> &entityB) {
+  Vec2 calculateOverlap(const Entity &entityA, const Entity &entityB) {
 
-    const auto &cShapeA = entityA->getComponent<CShape>();
-    const auto &cShapeB = entityB->getComponent<CShape>();
+    const auto &cShapeA = entityA.getComponent<CShape>();
+    const auto &cShapeB = entityB.getComponent<CShape>();
 
     if (!cShapeA) {
       SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
-                   "Entity with ID %zu and tag %u lacks a collision component.", entityA->id(),
-                   entityA->tag());
+                   "Entity with ID %zu and tag %u lacks a collision component.", entityA.id(),
+                   entityA.tag());
       return {0, 0};
     }
 
     if (!cShapeB) {
       SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
-                   "Entity with ID %zu and tag %u lacks a collision component.", entityB->id(),
-                   entityB->tag());
+                   "Entity with ID %zu and tag %u lacks a collision component.", entityB.id(),
+                   entityB.tag());
       return {0, 0};
     }
 
@@ -70,8 +70,8 @@ namespace CollisionHelpers {
     const auto halfSizeA = Vec2(halfWidthA, halfHeightA);
     const auto halfSizeB = Vec2(halfWidthB, halfHeightB);
 
-    const Vec2 &centerA = entityA->getCenterPos();
-    const Vec2 &centerB = entityB->getCenterPos();
+    const Vec2 &centerA = entityA.getCenterPos();
+    const Vec2 &centerB = entityB.getCenterPos();
 
     const auto delta = Vec2(std::abs(centerA.x - centerB.x), std::abs(centerA.y - centerB.y));
 
@@ -83,17 +83,15 @@ namespace CollisionHelpers {
     return overlap;
   }
 
-  bool calculateCollisionBetweenEntities(const std::shared_ptr<Entity> &entityA,
-                                         const std::shared_ptr<Entity> &entityB) {
+  bool calculateCollisionBetweenEntities(const Entity &entityA, const Entity &entityB) {
     const Vec2 overlap           = calculateOverlap(entityA, entityB);
     const bool collisionDetected = overlap.x > 0 && overlap.y > 0;
     return collisionDetected;
   }
 
-  std::bitset<4> getPositionRelativeToEntity(const std::shared_ptr<Entity> &entityA,
-                                             const std::shared_ptr<Entity> &entityB) {
-    const Vec2 &centerA = entityA->getCenterPos();
-    const Vec2 &centerB = entityB->getCenterPos();
+  std::bitset<4> getPositionRelativeToEntity(const Entity &entityA, const Entity &entityB) {
+    const Vec2 &centerA = entityA.getCenterPos();
+    const Vec2 &centerB = entityB.getCenterPos();
 
     std::bitset<4> relativePosition;
     relativePosition[ABOVE]    = centerA.y < centerB.y;
@@ -104,20 +102,111 @@ namespace CollisionHelpers {
     return relativePosition;
   }
 
+  std::optional<BoundingBox> calculateBoundingBox(const Entity &entity) {
+    const CTransform *cTransform = entity.getComponent<CTransform>();
+    const CShape     *cShape     = entity.getComponent<CShape>();
+
+    if (!cTransform || !cShape) {
+      return std::nullopt;
+    }
+
+    const Vec2 &topLeftCorner = cTransform->topLeftCornerPos;
+    const Vec2  size          = {static_cast<float>(cShape->rect.w),
+                                 static_cast<float>(cShape->rect.h)};
+
+    return BoundingBox{.min = topLeftCorner, .max = topLeftCorner + size};
+  }
+
+  std::optional<BoundingBox> calculateSweptBoundingBox(const Entity &entity) {
+    std::optional<BoundingBox> box = calculateBoundingBox(entity);
+    if (!box.has_value()) {
+      return std::nullopt;
+    }
+
+    const Vec2 &previousTopLeftCorner =
+        entity.getComponent<CTransform>()->previousTopLeftCornerPos;
+    const Vec2 size = box->max - box->min;
+
+    box->min = {std::min(box->min.x, previousTopLeftCorner.x),
+                std::min(box->min.y, previousTopLeftCorner.y)};
+    box->max = {std::max(box->max.x, previousTopLeftCorner.x + size.x),
+                std::max(box->max.y, previousTopLeftCorner.y + size.y)};
+    return box;
+  }
+
+  std::optional<float> calculateTimeOfImpact(const Entity &entityA, const Entity &entityB) {
+    const std::optional<BoundingBox> boxA = calculateBoundingBox(entityA);
+    const std::optional<BoundingBox> boxB = calculateBoundingBox(entityB);
+    if (!boxA.has_value() || !boxB.has_value()) {
+      return std::nullopt;
+    }
+
+    // Sweep A against B at rest, using A's movement relative to B's
+    const Vec2 &previousA = entityA.getComponent<CTransform>()->previousTopLeftCornerPos;
+    const Vec2 &previousB = entityB.getComponent<CTransform>()->previousTopLeftCornerPos;
+    const Vec2  movement  = (boxA->min - previousA) - (boxB->min - previousB);
+    const Vec2  sizeA     = boxA->max - boxA->min;
+    const Vec2  sizeB     = boxB->max - boxB->min;
+
+    float entryTime = -std::numeric_limits<float>::infinity();
+    float exitTime  = std::numeric_limits<float>::infinity();
+
+    // Slab test: the boxes touch while the entry/exit intervals of both axes overlap
+    auto sweepAxis = [&entryTime, &exitTime](const float start,
+                                             const float length,
+                                             const float otherStart,
+                                             const float otherLength,
+                                             const float distance) -> bool {
+      const float end      = start + length;
+      const float otherEnd = otherStart + otherLength;
+
+      // Without movement on this axis, the boxes must already overlap on it
+      if (distance == 0) {
+        return start < otherEnd && end > otherStart;
+      }
+
+      const float toEntry = distance > 0 ? otherStart - end : otherEnd - start;
+      const float toExit  = distance > 0 ? otherEnd - start : otherStart - end;
+      entryTime           = std::max(entryTime, toEntry / distance);
+      exitTime            = std::min(exitTime, toExit / distance);
+      return true;
+    };
+
+    if (!sweepAxis(previousA.x, sizeA.x, previousB.x, sizeB.x, movement.x) ||
+        !sweepAxis(previousA.y, sizeA.y, previousB.y, sizeB.y, movement.y)) {
+      return std::nullopt;
+    }
+
+    if (entryTime >= exitTime || entryTime < 0 || entryTime > 1) {
+      return std::nullopt;
+    }
+
+    return entryTime;
+  }
+
+  CCollisionFilter getCollisionFilter(const Entity &entity) {
+    const CCollisionFilter *cCollisionFilter = entity.getComponent<CCollisionFilter>();
+    return cCollisionFilter ? *cCollisionFilter : CCollisionFilter();
+  }
+
+  bool canInteract(const CCollisionFilter &filterA, const CCollisionFilter &filterB) {
+    return filterA.reactsTo(filterB) || filterB.reactsTo(filterA);
+  }
+
 } // namespace CollisionHelpers
 
 namespace CollisionHelpers::MainScene::Enforce {
-  void enforcePlayerBounds(const std::shared_ptr<Entity> &entity,
-                           const std::bitset<4>          &collides,
-                           const Vec2                    &window_size) {
+  void enforcePlayerBounds(const Entity         &entity,
+                           const std::bitset<4> &collides,
+                           const Vec2           &window_size) {
 
-    const std::shared_ptr<CShape>     &cShape     = entity->getComponent<CShape>();
-    const std::shared_ptr<CTransform> &cTransform = entity->getComponent<CTransform>();
+    const CShape *cShape     = entity.getComponent<CShape>();
+    CTransform   *cTransform = entity.getComponent<CTransform>();
 
     if (!cShape || !cTransform) {
       SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
                    "Entity with ID %zu and tag %u lacks a transform or shape component.",
-                   entity->id(), entity->tag());
+                   entity.id(), entity.tag());
     };
 
     Vec2 &leftCornerPosition = cTransform->topLeftCornerPos;
@@ -136,24 +225,22 @@ namespace CollisionHelpers::MainScene::Enforce {
     }
   }
 
-  void enforceNonPlayerBounds(const std::shared_ptr<Entity> &entity,
-                              const std::bitset<4>          &collides) {
-    if (entity->tag() == EntityTags::Player) {
+  void enforceNonPlayerBounds(const Entity &entity, const std::bitset<4> &collides) {
+    if (entity.tag() == EntityTags::Player) {
       return;
     }
 
     if (collides.any()) {
-      entity->destroy();
+      entity.destroy();
     }
   }
 
-  void enforceCollisionWithWall(const std::shared_ptr<Entity> &entity,
-                                const std::shared_ptr<Entity> &wall) {
-
-    const auto &cTransform     = entity->getComponent<CTransform>();
-    const auto &cBounceTracker = entity->getComponent<CBounceTracker>();
+  void enforceCollisionWithWall(const Entity &entity,
+                                const Entity &wall,
+                                const Vec2   &overlap) {
 
-    const Vec2 &overlap = calculateOverlap(entity, wall);
+    const auto &cTransform     = entity.getComponent<CTransform>();
+    const auto &cBounceTracker = entity.getComponent<CBounceTracker>();
 
     const bool           mustResolveCollisionVertically   = overlap.x > overlap.y;
     const bool           mustResolveCollisionHorizontally = overlap.x < overlap.y;
@@ -189,12 +276,39 @@ namespace CollisionHelpers::MainScene::Enforce {
     }
   }
 
-  void enforceEntityEntityCollision(const std::shared_ptr<Entity> &entityA,
-                                    const std::shared_ptr<Entity> &entityB) {
-    const auto &cTransformA = entityA->getComponent<CTransform>();
-    const auto &cTransformB = entityB->getComponent<CTransform>();
+  bool enforceContinuousCollision(const Entity &entity, const Entity &otherEntity) {
+    const std::optional<float> timeOfImpact = calculateTimeOfImpact(entity, otherEntity);
+    if (!timeOfImpact.has_value()) {
+      return false;
+    }
+
+    // Pull the entity back to where it first touched the other entity, keeping their relative
+    // placement at that moment. A small push along the movement leaves them overlapping on
+    // the axis they met on, which is the axis the responses resolve along.
+    constexpr float CONTACT_DEPTH = 0.01f;
+
+    CTransform       *cTransform      = entity.getComponent<CTransform>();
+    const CTransform *otherCTransform = otherEntity.getComponent<CTransform>();
+
+    const Vec2 movement = cTransform->topLeftCornerPos - cTransform->previousTopLeftCornerPos;
+    const Vec2 otherMovement =
+        otherCTransform->topLeftCornerPos - otherCTransform->previousTopLeftCornerPos;
+    const Vec2 relativeMovement = movement - otherMovement;
+
+    Vec2 direction = relativeMovement;
+    direction.normalize();
+
+    const Vec2 contactOffset = relativeMovement * *timeOfImpact + direction * CONTACT_DEPTH;
+    cTransform->topLeftCornerPos =
+        cTransform->previousTopLeftCornerPos + otherMovement + contactOffset;
+    return true;
+  }
 
-    const Vec2 &overlap = calculateOverlap(entityA, entityB);
+  void enforceEntityEntityCollision(const Entity &entityA,
+                                    const Entity &entityB,
+                                    const Vec2   &overlap) {
+    const auto &cTransformA = entityA.getComponent<CTransform>();
+    const auto &cTransformB = entityB.getComponent<CTransform>();
 
     const bool           mustResolveCollisionVertically   = overlap.x > overlap.y;
     const bool           mustResolveCollisionHorizontally = overlap.x < overlap.y;
@@ -257,8 +371,8 @@ namespace CollisionHelpers::MainScene::Enforce {
 } // namespace CollisionHelpers::MainScene::Enforce
 
 namespace CollisionHelpers::MainScene {
-  void handleEntityBounds(const std::shared_ptr<Entity> &entity, const Vec2 &windowSize) {
-    const auto tag = entity->tag();
+  void handleEntityBounds(const Entity &entity, const Vec2 &windowSize) {
+    const auto tag = entity.tag();
     if (tag == EntityTags::SpeedBoost) {
       const std::bitset<4> speedBoostCollides = detectOutOfBounds(entity, windowSize);
       Enforce::enforceNonPlayerBounds(entity, speedBoostCollides);
@@ -289,198 +403,261 @@ namespace CollisionHelpers::MainScene {
     }
   }
 
-  void handleEntityEntityCollision(const CollisionPair &collisionPair, const GameState &args) {
-    const std::shared_ptr<Entity> &entity      = collisionPair.entityA;
-    const std::shared_ptr<Entity> &otherEntity = collisionPair.entityB;
+  /**
+   * @brief Builds the response table. Pairs without an entry, such as Wall/Wall or Item/Item,
+   * never interact.
+   */
+  constexpr CollisionResponseTable buildCollisionResponseTable() {
+    CollisionResponseTable table{};
+
+    for (size_t tag = 0; tag < ENTITY_TAG_COUNT; tag++) {
+      table[tag][EntityTags::Wall] = Respond::bounceOffWall;
+    }
+    table[EntityTags::Wall][EntityTags::Wall]   = nullptr;
+    table[EntityTags::Bullet][EntityTags::Wall] = Respond::bulletHitsWall;
+
+    table[EntityTags::Enemy][EntityTags::Enemy]          = Respond::pushApart;
+    table[EntityTags::Enemy][EntityTags::SpeedBoost]     = Respond::pushApart;
+    table[EntityTags::Enemy][EntityTags::SlownessDebuff] = Respond::pushApart;
+    table[EntityTags::Item][EntityTags::Enemy]           = Respond::pushApart;
+    table[EntityTags::Item][EntityTags::SpeedBoost]      = Respond::pushApart;
+    table[EntityTags::Item][EntityTags::SlownessDebuff]  = Respond::pushApart;
+
+    table[EntityTags::Bullet][EntityTags::Enemy]          = Respond::bulletHitsEnemy;
+    table[EntityTags::Bullet][EntityTags::SlownessDebuff] = Respond::bulletHitsPickup;
+    table[EntityTags::Bullet][EntityTags::SpeedBoost]     = Respond::bulletHitsPickup;
+    table[EntityTags::Bullet][EntityTags::Item]           = Respond::bulletHitsPickup;
+
+    table[EntityTags::Player][EntityTags::Enemy]          = Respond::playerHitsEnemy;
+    table[EntityTags::Player][EntityTags::SlownessDebuff] = Respond::playerCollectsSlowness;
+    table[EntityTags::Player][EntityTags::SpeedBoost]     = Respond::playerCollectsSpeedBoost;
+    table[EntityTags::Player][EntityTags::Item]           = Respond::playerCollectsItem;
+
+    return table;
+  }
 
-    const EntityTags tag      = entity->tag();
-    const EntityTags otherTag = otherEntity->tag();
+  constexpr CollisionResponseTable COLLISION_RESPONSES = buildCollisionResponseTable();
 
-    constexpr Uint64 minSlownessDuration   = 5000;
-    constexpr Uint64 maxSlownessDuration   = 10000;
-    constexpr Uint64 minSpeedBoostDuration = 9000;
-    constexpr Uint64 maxSpeedBoostDuration = 15000;
+  CollisionResponse getCollisionResponse(const EntityTags tag, const EntityTags otherTag) {
+    return COLLISION_RESPONSES[tag][otherTag];
+  }
 
-    std::uniform_int_distribution<Uint64> randomSlownessDuration(minSlownessDuration,
-                                                                 maxSlownessDuration);
-    std::uniform_int_distribution<Uint64> randomSpeedBoostDuration(minSpeedBoostDuration,
-                                                                   maxSpeedBoostDuration);
+  bool usesContinuousCollision(const Entity &entity) {
+    // Bullets can cross a thin wall or an enemy within one frame
+    return entity.tag() == EntityTags::Bullet;
+  }
 
-    const int                      m_score           = args.score;
-    EntityManager                 &m_entities        = args.entityManager;
-    std::mt19937                  &m_randomGenerator = args.randomGenerator;
-    const std::function<void()>    decrementLives    = args.decrementLives;
-    const std::function<void(int)> setScore          = args.setScore;
-    const Vec2                    &windowSize        = args.windowSize;
+  bool handleEntityEntityCollision(const CollisionPair &collisionPair, const GameState &args) {
+    const Entity &entity      = collisionPair.entityA;
+    const Entity &otherEntity = collisionPair.entityB;
 
-    if (entity == otherEntity) {
-      return;
+    // Skip pairs that never interact before doing any overlap math. The layer masks come from
+    // the config; the response table covers tag pairs the game has no behaviour for.
+    if (!getCollisionFilter(entity).reactsTo(getCollisionFilter(otherEntity))) {
+      return false;
     }
 
-    const bool entitiesCollided =
-        CollisionHelpers::calculateCollisionBetweenEntities(entity, otherEntity);
-
-    if (!entitiesCollided) {
-      return;
+    const CollisionResponse response = getCollisionResponse(entity.tag(), otherEntity.tag());
+    if (response == nullptr) {
+      return false;
     }
 
-    if (otherTag == EntityTags::Wall) {
-      Enforce::enforceCollisionWithWall(entity, otherEntity);
+    if (entity == otherEntity) {
+      return false;
     }
 
-    if (tag == EntityTags::Enemy && otherTag == EntityTags::Enemy) {
-      Enforce::enforceEntityEntityCollision(entity, otherEntity);
-    }
+    const Vec2 &overlap          = collisionPair.overlap;
+    const bool  entitiesCollided = overlap.x > 0 && overlap.y > 0;
 
-    if (tag == EntityTags::Enemy && otherTag == EntityTags::SpeedBoost) {
-      Enforce::enforceEntityEntityCollision(entity, otherEntity);
+    if (entitiesCollided) {
+      response(collisionPair, args);
+      return true;
     }
 
-    if (tag == EntityTags::Enemy && otherTag == EntityTags::SlownessDebuff) {
-      Enforce::enforceEntityEntityCollision(entity, otherEntity);
+    if (!usesContinuousCollision(entity) ||
+        !Enforce::enforceContinuousCollision(entity, otherEntity)) {
+      return false;
     }
 
-    if (tag == EntityTags::Bullet && otherTag == EntityTags::Enemy) {
-      AudioSample nextSample = AudioSample::BULLET_HIT_02;
-      args.audioSampleManager.queueSample(nextSample, AudioSamplePriority::STANDARD);
+    // The sweep moved the entity to where the two first touched, so the overlap given by the
+    // caller no longer applies
+    response({.entityA = entity,
+              .entityB = otherEntity,
+              .overlap = calculateOverlap(entity, otherEntity)},
+             args);
+    return true;
+  }
+
+} // namespace CollisionHelpers::MainScene
 
-      const auto &cBounceTracker = entity->getComponent<CBounceTracker>();
+namespace CollisionHelpers::MainScene::Respond {
+  void bounceOffWall(const CollisionPair &collisionPair, const GameState &) {
+    Enforce::enforceCollisionWithWall(collisionPair.entityA, collisionPair.entityB,
+                                      collisionPair.overlap);
+  }
 
-      if (!cBounceTracker) {
-        entity->destroy();
-        return;
-      }
-      const int bounces = cBounceTracker->getBounces();
-      setScore(5 * (bounces + 1) + m_score);
-      otherEntity->destroy();
-      entity->destroy();
-    }
+  void pushApart(const CollisionPair &collisionPair, const GameState &) {
+    Enforce::enforceEntityEntityCollision(collisionPair.entityA, collisionPair.entityB,
+                                          collisionPair.overlap);
+  }
 
-    if (tag == EntityTags::Bullet && otherTag == EntityTags::Wall) {
-      args.audioSampleManager.queueSample(AudioSample::BULLET_HIT_01,
-                                          AudioSamplePriority::BACKGROUND);
+  void bulletHitsWall(const CollisionPair &collisionPair, const GameState &args) {
+    Enforce::enforceCollisionWithWall(collisionPair.entityA, collisionPair.entityB,
+                                      collisionPair.overlap);
+    args.audioSampleManager.queueSample(AudioSample::BULLET_HIT_01,
+                                        AudioSamplePriority::BACKGROUND);
+  }
+
+  void bulletHitsEnemy(const CollisionPair &collisionPair, const GameState &args) {
+    const Entity &bullet = collisionPair.entityA;
+    const Entity &enemy  = collisionPair.entityB;
+
+    AudioSample nextSample = AudioSample::BULLET_HIT_02;
+    args.audioSampleManager.queueSample(nextSample, AudioSamplePriority::STANDARD);
+
+    const auto &cBounceTracker = bullet.getComponent<CBounceTracker>();
+
+    if (!cBounceTracker) {
+      bullet.destroy();
+      return;
     }
+    const int bounces = cBounceTracker->getBounces();
+    args.setScore(5 * (bounces + 1) + args.score);
+    enemy.destroy();
+    bullet.destroy();
+  }
 
-    if (tag == EntityTags::Bullet &&
-        (otherTag == EntityTags::SlownessDebuff || otherTag == EntityTags::SpeedBoost ||
-         otherTag == EntityTags::Item)) {
-      otherEntity->destroy();
-      entity->destroy();
+  void bulletHitsPickup(const CollisionPair &collisionPair, const GameState &args) {
+    const Entity &bullet = collisionPair.entityA;
+    const Entity &pickup = collisionPair.entityB;
 
-      if (m_score > 15) {
-        const auto updatedScore =
-            otherTag == EntityTags::SlownessDebuff ? m_score + 15 : m_score - 15;
-        setScore(updatedScore);
-      }
+    const EntityTags pickupTag = pickup.tag();
+    pickup.destroy();
+    bullet.destroy();
+
+    if (args.score > 15) {
+      const auto updatedScore =
+          pickupTag == EntityTags::SlownessDebuff ? args.score + 15 : args.score - 15;
+      args.setScore(updatedScore);
     }
+  }
 
-    if (tag == EntityTags::Player && otherTag == EntityTags::Enemy) {
-      args.audioSampleManager.queueSample(AudioSample::ENEMY_COLLISION,
-                                          AudioSamplePriority::STANDARD);
-      setScore(m_score > 10 ? m_score - 10 : 0);
-      otherEntity->destroy();
-      decrementLives();
+  void playerHitsEnemy(const CollisionPair &collisionPair, const GameState &args) {
+    const Entity &player = collisionPair.entityA;
+    const Entity &enemy  = collisionPair.entityB;
 
-      const std::shared_ptr<CTransform> &cTransform = entity->getComponent<CTransform>();
-      const std::shared_ptr<CEffects>   &cEffects   = entity->getComponent<CEffects>();
-      cTransform->topLeftCornerPos                  = {windowSize.x / 2, windowSize.y / 2};
+    const Vec2 &windowSize = args.windowSize;
 
-      constexpr float    REMOVAL_RADIUS   = 150.0f;
-      const EntityVector entitiesToRemove = EntityHelpers::getEntitiesInRadius(
-          entity, m_entities.getEntities(EntityTags::Enemy), REMOVAL_RADIUS);
+    args.audioSampleManager.queueSample(AudioSample::ENEMY_COLLISION,
+                                        AudioSamplePriority::STANDARD);
+    args.setScore(args.score > 10 ? args.score - 10 : 0);
+    enemy.destroy();
+    args.decrementLives();
 
-      for (const std::shared_ptr<Entity> &entityToRemove : entitiesToRemove) {
-        entityToRemove->destroy();
-      }
+    CTransform *cTransform = player.getComponent<CTransform>();
+    CEffects   *cEffects   = player.getComponent<CEffects>();
+    cTransform->teleport({windowSize.x / 2, windowSize.y / 2});
+
+    constexpr float    REMOVAL_RADIUS   = 150.0f;
+    const EntityVector entitiesToRemove = EntityHelpers::getEntitiesInRadius(
+        player, args.entityManager.getEntities(EntityTags::Enemy), REMOVAL_RADIUS);
 
-      cEffects->clearEffects();
+    for (const Entity &entityToRemove : entitiesToRemove) {
+      entityToRemove.destroy();
     }
 
-    if (tag == EntityTags::Player && otherTag == EntityTags::SlownessDebuff) {
-      const Uint64 startTime = SDL_GetTicks64();
-      const Uint64 duration  = randomSlownessDuration(m_randomGenerator);
+    cEffects->clearEffects();
+  }
+
+  void playerCollectsSlowness(const CollisionPair &collisionPair, const GameState &args) {
+    const Entity &player = collisionPair.entityA;
 
-      const auto &cEffects = entity->getComponent<CEffects>();
-      cEffects->addEffect(
-          {.startTime = startTime, .duration = duration, .type = EffectTypes::Slowness});
+    constexpr Uint64 minSlownessDuration = 5000;
+    constexpr Uint64 maxSlownessDuration = 10000;
 
-      EntityVector        effectsToCheck;
-      const EntityVector &slownessDebuffs = m_entities.getEntities(EntityTags::SlownessDebuff);
-      const EntityVector &speedBoosts     = m_entities.getEntities(EntityTags::SpeedBoost);
+    std::uniform_int_distribution<Uint64> randomSlownessDuration(minSlownessDuration,
+                                                                 maxSlownessDuration);
 
-      effectsToCheck.insert(effectsToCheck.end(), slownessDebuffs.begin(),
-                            slownessDebuffs.end());
-      effectsToCheck.insert(effectsToCheck.end(), speedBoosts.begin(), speedBoosts.end());
+    const Uint64 startTime = GameClock::getTicks();
+    const Uint64 duration  = randomSlownessDuration(args.randomGenerator);
 
-      const AudioSample nextSample = AudioSample::SLOWNESS_DEBUFF;
-      args.audioSampleManager.queueSample(nextSample, AudioSamplePriority::STANDARD);
+    const auto &cEffects = player.getComponent<CEffects>();
+    cEffects->addEffect(
+        {.startTime = startTime, .duration = duration, .type = EffectTypes::Slowness});
 
-      constexpr float    REMOVAL_RADIUS = 150.0f;
-      const EntityVector entitiesToRemove =
-          EntityHelpers::getEntitiesInRadius(entity, effectsToCheck, REMOVAL_RADIUS);
+    EntityVector     effectsToCheck;
+    const EntitySpan slownessDebuffs =
+        args.entityManager.getEntities(EntityTags::SlownessDebuff);
+    const EntitySpan speedBoosts = args.entityManager.getEntities(EntityTags::SpeedBoost);
 
-      for (const auto &entityToRemove : entitiesToRemove) {
-        entityToRemove->destroy();
-      }
+    effectsToCheck.insert(effectsToCheck.end(), slownessDebuffs.begin(),
+                          slownessDebuffs.end());
+    effectsToCheck.insert(effectsToCheck.end(), speedBoosts.begin(), speedBoosts.end());
 
-      for (const auto &speedBoost : speedBoosts) {
-        speedBoost->destroy();
-      }
+    const AudioSample nextSample = AudioSample::SLOWNESS_DEBUFF;
+    args.audioSampleManager.queueSample(nextSample, AudioSamplePriority::STANDARD);
+
+    constexpr float    REMOVAL_RADIUS = 150.0f;
+    const EntityVector entitiesToRemove =
+        EntityHelpers::getEntitiesInRadius(player, effectsToCheck, REMOVAL_RADIUS);
+
+    for (const auto &entityToRemove : entitiesToRemove) {
+      entityToRemove.destroy();
     }
 
-    if (tag == EntityTags::Player && otherTag == EntityTags::SpeedBoost) {
-      const Uint64 startTime = SDL_GetTicks64();
-      const Uint64 duration  = randomSpeedBoostDuration(m_randomGenerator);
-      const auto  &cEffects  = entity->getComponent<CEffects>();
+    for (const auto &speedBoost : speedBoosts) {
+      speedBoost.destroy();
+    }
+  }
+
+  void playerCollectsSpeedBoost(const CollisionPair &collisionPair, const GameState &args) {
+    const Entity &player = collisionPair.entityA;
 
-      cEffects->addEffect(
-          {.startTime = startTime, .duration = duration, .type = EffectTypes::Speed});
+    constexpr Uint64 minSpeedBoostDuration = 9000;
+    constexpr Uint64 maxSpeedBoostDuration = 15000;
 
-      const AudioSample nextSample = AudioSample::SPEED_BOOST;
-      args.audioSampleManager.queueSample(nextSample, AudioSamplePriority::STANDARD);
+    std::uniform_int_distribution<Uint64> randomSpeedBoostDuration(minSpeedBoostDuration,
+                                                                   maxSpeedBoostDuration);
 
-      const EntityVector &slownessDebuffs = m_entities.getEntities(EntityTags::SlownessDebuff);
-      const EntityVector &speedBoosts     = m_entities.getEntities(EntityTags::SpeedBoost);
+    const Uint64 startTime = GameClock::getTicks();
+    const Uint64 duration  = randomSpeedBoostDuration(args.randomGenerator);
+    const auto  &cEffects  = player.getComponent<CEffects>();
 
-      constexpr float    REMOVAL_RADIUS = 150.0f;
-      const EntityVector entitiesToRemove =
-          EntityHelpers::getEntitiesInRadius(entity, speedBoosts, REMOVAL_RADIUS);
+    cEffects->addEffect(
+        {.startTime = startTime, .duration = duration, .type = EffectTypes::Speed});
 
-      for (const auto &entityToRemove : entitiesToRemove) {
-        entityToRemove->destroy();
-      }
+    const AudioSample nextSample = AudioSample::SPEED_BOOST;
+    args.audioSampleManager.queueSample(nextSample, AudioSamplePriority::STANDARD);
 
-      // set the lifespan of the speed boost to 10% of previous value
-      for (const auto &speedBoost : speedBoosts) {
-        constexpr float MULTIPLIER = 0.1f;
-        const auto     &cLifespan  = speedBoost->getComponent<CLifespan>();
-        Uint64         &lifespan   = cLifespan->lifespan;
+    const EntitySpan slownessDebuffs =
+        args.entityManager.getEntities(EntityTags::SlownessDebuff);
+    const EntitySpan speedBoosts = args.entityManager.getEntities(EntityTags::SpeedBoost);
 
-        lifespan = static_cast<Uint64>(std::round(static_cast<float>(lifespan) * MULTIPLIER));
-      }
-      for (const auto &slowDebuff : slownessDebuffs) {
-        slowDebuff->destroy();
-      }
-    }
+    constexpr float    REMOVAL_RADIUS = 150.0f;
+    const EntityVector entitiesToRemove =
+        EntityHelpers::getEntitiesInRadius(player, speedBoosts, REMOVAL_RADIUS);
 
-    if (tag == EntityTags::Player && otherTag == EntityTags::Item) {
-      args.audioSampleManager.queueSample(AudioSample::ITEM_ACQUIRED,
-                                          AudioSamplePriority::STANDARD);
-      setScore(m_score + 90);
-      otherEntity->destroy();
+    for (const auto &entityToRemove : entitiesToRemove) {
+      entityToRemove.destroy();
     }
 
-    if (tag == EntityTags::Item && otherTag == EntityTags::Enemy) {
-      Enforce::enforceEntityEntityCollision(entity, otherEntity);
-    }
+    // set the lifespan of the speed boost to 10% of previous value
+    for (const auto &speedBoost : speedBoosts) {
+      constexpr float MULTIPLIER = 0.1f;
+      const auto     &cLifespan  = speedBoost.getComponent<CLifespan>();
+      Uint64         &lifespan   = cLifespan->lifespan;
 
-    if (tag == EntityTags::Item && otherTag == EntityTags::SpeedBoost) {
-      Enforce::enforceEntityEntityCollision(entity, otherEntity);
+      lifespan = static_cast<Uint64>(std::round(static_cast<float>(lifespan) * MULTIPLIER));
     }
-
-    if (tag == EntityTags::Item && otherTag == EntityTags::SlownessDebuff) {
-      Enforce::enforceEntityEntityCollision(entity, otherEntity);
+    for (const auto &slowDebuff : slownessDebuffs) {
+      slowDebuff.destroy();
     }
   }
 
-} // namespace CollisionHelpers::MainScene
\ No newline at end of file
+  void playerCollectsItem(const CollisionPair &collisionPair, const GameState &args) {
+    args.audioSampleManager.queueSample(AudioSample::ITEM_ACQUIRED,
+                                        AudioSamplePriority::STANDARD);
+    args.setScore(args.score + 90);
+    collisionPair.entityB.destroy();
+  }
+} // namespace CollisionHelpers::MainScene::Respond
\ No newline at end of file
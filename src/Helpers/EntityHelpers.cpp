@@ -4,18 +4,18 @@
 #include <vector>
 
 namespace EntityHelpers {
-  EntityVector findClosestEntities(const std::shared_ptr<Entity> &entity,
-                                   const EntityVector            &candidates,
-                                   const size_t                  &limit) {
+  EntityVector findClosestEntities(const Entity &entity,
+                                   EntitySpan    candidates,
+                                   const size_t &limit) {
 
-    std::vector<std::pair<std::shared_ptr<Entity>, float>> distances;
-    const Vec2                                            &center = entity->getCenterPos();
+    std::vector<std::pair<Entity, float>> distances;
+    const Vec2                           &center = entity.getCenterPos();
 
     for (const auto &candidate : candidates) {
       if (candidate == entity)
         continue;
 
-      const Vec2 &candidateCenter = candidate->getCenterPos();
+      const Vec2 &candidateCenter = candidate.getCenterPos();
 
       float distance = MathHelpers::pythagorasSquared(center.x - candidateCenter.x,
                                                       center.y - candidateCenter.y);
@@ -34,19 +34,19 @@ namespace EntityHelpers {
     return result;
   }
 
-  EntityVector getEntitiesInRadius(const std::shared_ptr<Entity> &entity,
-                                   const EntityVector            &candidates,
-                                   const float                   &radius) {
+  EntityVector getEntitiesInRadius(const Entity &entity,
+                                   EntitySpan    candidates,
+                                   const float  &radius) {
 
     EntityVector result;
-    const Vec2  &center        = entity->getCenterPos();
+    const Vec2  &center        = entity.getCenterPos();
     const float  radiusSquared = radius * radius;
 
     for (const auto &candidate : candidates) {
       if (candidate == entity)
         continue;
 
-      const Vec2 &candidateCenter = candidate->getCenterPos();
+      const Vec2 &candidateCenter = candidate.getCenterPos();
 
       const float deltaX          = center.x - candidateCenter.x;
       const float deltaY          = center.y - candidateCenter.y;
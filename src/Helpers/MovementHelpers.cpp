@@ -1,86 +1,25 @@
 #include "../../includes/Helpers/MovementHelpers.hpp"
+#include "../../includes/EntityManagement/EntityAccessors.hpp"
+#include "../../includes/GameEngine/GameClock.hpp"
 
 constexpr float BASE_MOVEMENT_MULTIPLIER = 50.0f;
 
 namespace MovementHelpers {
 
-  void moveEnemies(const std::shared_ptr<Entity> &entity,
-                   const EnemyConfig             &enemyConfig,
-                   const float                   &deltaTime) {
-
-    if (entity == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Entity is null");
-      return;
-    }
-
-    const EntityTags entityTag = entity->tag();
-    if (entityTag != EntityTags::Enemy) {
-      return;
-    }
-
-    const std::shared_ptr<CTransform> &entityCTransform = entity->getComponent<CTransform>();
-    if (entityCTransform == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                   "Entity with ID %zu lacks a transform component.", entity->id());
-      return;
-    }
-
-    Vec2       &position = entityCTransform->topLeftCornerPos;
-    const Vec2 &velocity = entityCTransform->velocity;
-
-    position += velocity * (enemyConfig.speed * (deltaTime * BASE_MOVEMENT_MULTIPLIER));
-  }
-
-  void moveSpeedBoosts(const std::shared_ptr<Entity> &entity,
-                       const SpeedEffectConfig       &speedBoostEffectConfig,
-                       const float                   &deltaTime) {
-    if (entity == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Entity is null");
-      return;
-    }
-
-    const EntityTags entityTag = entity->tag();
-    if (entityTag != EntityTags::SpeedBoost) {
-      return;
-    }
-
-    const std::shared_ptr<CTransform> &entityCTransform = entity->getComponent<CTransform>();
+  void movePlayer(const Entity       &entity,
+                  const PlayerConfig &playerConfig,
+                  const float        &deltaTime) {
+    CTransform *entityCTransform = entity.getComponent<CTransform>();
     if (entityCTransform == nullptr) {
       SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                   "Entity with ID %zu lacks a transform component.", entity->id());
+                   "Entity with ID %zu lacks a transform component.", entity.id());
       return;
     }
 
-    Vec2       &position = entityCTransform->topLeftCornerPos;
-    const Vec2 &velocity = entityCTransform->velocity;
-
-    position += velocity * deltaTime * speedBoostEffectConfig.speed * BASE_MOVEMENT_MULTIPLIER;
-  }
-
-  void movePlayer(const std::shared_ptr<Entity> &entity,
-                  const PlayerConfig            &playerConfig,
-                  const float                   &deltaTime) {
-    if (entity == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Entity is null");
-      return;
-    }
-
-    const EntityTags entityTag = entity->tag();
-    if (entityTag != EntityTags::Player) {
-      return;
-    }
-
-    const std::shared_ptr<CTransform> &entityCTransform = entity->getComponent<CTransform>();
-    if (entityCTransform == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                   "Entity with ID %zu lacks a transform component.", entity->id());
-      return;
-    }
-
-    const std::shared_ptr<CInput> &entityCInput = entity->getComponent<CInput>();
+    CInput *entityCInput = entity.getComponent<CInput>();
     if (entityCInput == nullptr) {
       SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                   "Entity with ID %zu lacks an input component.", entity->id());
+                   "Entity with ID %zu lacks an input component.", entity.id());
       return;
     }
 
@@ -104,7 +43,7 @@ namespace MovementHelpers {
 
     velocity.normalize();
 
-    const std::shared_ptr<CEffects> &entityEffects = entity->getComponent<CEffects>();
+    CEffects *entityEffects = entity.getComponent<CEffects>();
 
     float effectMultiplier = 1;
     if (entityEffects->hasEffect(EffectTypes::Speed)) {
@@ -120,106 +59,47 @@ namespace MovementHelpers {
     position += velocity;
   }
 
-  void moveSlownessDebuffs(const std::shared_ptr<Entity> &entity,
-                           const SlownessEffectConfig    &slownessEffectConfig,
-                           const float                   &deltaTime) {
-
-    if (entity == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Entity is null");
-      return;
-    }
-
-    const EntityTags entityTag = entity->tag();
-    if (entityTag != EntityTags::SlownessDebuff) {
-      return;
-    }
-
-    const std::shared_ptr<CTransform> &entityCTransform = entity->getComponent<CTransform>();
-    const std::shared_ptr<CShape>     &entityCShape     = entity->getComponent<CShape>();
+  void moveLinear(const Entity &entity, const float &deltaTime) {
+    CTransform            *entityCTransform = entity.getComponent<CTransform>();
+    const CLinearMovement *entityCMovement  = entity.getComponent<CLinearMovement>();
 
-    if (entityCTransform == nullptr) {
+    if (entityCTransform == nullptr || entityCMovement == nullptr) {
       SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                   "Entity with ID %zu lacks a transform component.", entity->id());
-
-      return;
-    }
-
-    if (entityCShape == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Entity with ID %zu lacks a shape component.",
-                   entity->id());
-
+                   "Entity with ID %zu lacks a transform or movement component.", entity.id());
       return;
     }
 
     Vec2       &position = entityCTransform->topLeftCornerPos;
     const Vec2 &velocity = entityCTransform->velocity;
 
-    position += velocity * deltaTime * slownessEffectConfig.speed * BASE_MOVEMENT_MULTIPLIER;
+    position += velocity * (entityCMovement->speed * (deltaTime * BASE_MOVEMENT_MULTIPLIER));
   }
 
-  void moveBullets(const std::shared_ptr<Entity> &entity, const float &deltaTime) {
-    if (entity == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Entity is null");
-      return;
-    }
-
-    const EntityTags entityTag = entity->tag();
-    if (entityTag != EntityTags::Bullet) {
-      return;
-    }
+  void moveDrifting(const Entity &entity, const float &deltaTime) {
+    CTransform           *entityCTransform = entity.getComponent<CTransform>();
+    const CDriftMovement *entityCMovement  = entity.getComponent<CDriftMovement>();
 
-    const std::shared_ptr<CTransform> &entityCTransform = entity->getComponent<CTransform>();
-    if (entityCTransform == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                   "Entity with ID %zu lacks a transform component.", entity->id());
-      return;
-    }
-
-    Vec2       &position = entityCTransform->topLeftCornerPos;
-    const Vec2 &velocity = entityCTransform->velocity;
-
-    constexpr float BULLET_MOVEMENT_MULTIPLIER = 3.0f;
-    position += velocity * (deltaTime * BULLET_MOVEMENT_MULTIPLIER * BASE_MOVEMENT_MULTIPLIER);
-  }
-  void moveItems(const std::shared_ptr<Entity> &entity, const float &deltaTime) {
-    if (entity == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Entity is null");
-      return;
-    }
-
-    const EntityTags entityTag = entity->tag();
-
-    if (entityTag != EntityTags::Item) {
-      return;
-    }
-
-    const std::shared_ptr<CTransform> &entityCTransform = entity->getComponent<CTransform>();
-
-    if (entityCTransform == nullptr) {
+    if (entityCTransform == nullptr || entityCMovement == nullptr) {
       SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                   "Entity with ID %zu lacks a transform component.", entity->id());
+                   "Entity with ID %zu lacks a transform or movement component.", entity.id());
       return;
     }
 
     Vec2 &position = entityCTransform->topLeftCornerPos;
 
     // Use deltaTime to maintain consistent movement speed
-    constexpr float ITEM_MOVEMENT_MULTIPLIER = .9f;
-    const float     time                     = static_cast<float>(SDL_GetTicks64()) / 1000.0f;
+    const float speed = entityCMovement->speed;
+    const float time  = static_cast<float>(GameClock::getTicks()) / 1000.0f;
     // Entity id will be odd when the last bit is 1
-    const bool ENTITY_ID_ODD = entity->id() & 1;
+    const bool ENTITY_ID_ODD = entity.id() & 1;
 
     if (ENTITY_ID_ODD) {
-      position.x +=
-          std::cos(time) * (ITEM_MOVEMENT_MULTIPLIER * deltaTime * BASE_MOVEMENT_MULTIPLIER);
-      position.y +=
-          std::sin(time) * (ITEM_MOVEMENT_MULTIPLIER * deltaTime * BASE_MOVEMENT_MULTIPLIER);
+      position.x += std::cos(time) * (speed * deltaTime * BASE_MOVEMENT_MULTIPLIER);
+      position.y += std::sin(time) * (speed * deltaTime * BASE_MOVEMENT_MULTIPLIER);
 
     } else {
-      position.x +=
-          std::sin(time) * (ITEM_MOVEMENT_MULTIPLIER * deltaTime * BASE_MOVEMENT_MULTIPLIER);
-      position.y +=
-          std::cos(time) * (ITEM_MOVEMENT_MULTIPLIER * deltaTime * BASE_MOVEMENT_MULTIPLIER);
+      position.x += std::sin(time) * (speed * deltaTime * BASE_MOVEMENT_MULTIPLIER);
+      position.y += std::cos(time) * (speed * deltaTime * BASE_MOVEMENT_MULTIPLIER);
     }
   }
 } // namespace MovementHelpers
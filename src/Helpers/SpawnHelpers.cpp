@@ -1,5 +1,5 @@
 #include "../../includes/Helpers/SpawnHelpers.hpp"
-#include "../../includes/EntityManagement/Entity.hpp"
+#include "../../includes/EntityManagement/EntityAccessors.hpp"
 #include "../../includes/Helpers/CollisionHelpers.hpp"
 #include "../../includes/Helpers/MathHelpers.hpp"
 
@@ -33,10 +33,10 @@ namespace SpawnHelpers {
                                     : velocity;
   };
 
-  bool validateSpawnPosition(const std::shared_ptr<Entity> &entity,
-                             const std::shared_ptr<Entity> &player,
-                             EntityManager                 &entityManager,
-                             const Vec2                    &windowSize) {
+  bool validateSpawnPosition(const Entity  &entity,
+                             const Entity  &player,
+                             EntityManager &entityManager,
+                             const Vec2    &windowSize) {
     constexpr int MIN_DISTANCE_TO_PLAYER = 40;
 
     const bool touchesBoundary = CollisionHelpers::detectOutOfBounds(entity, windowSize).any();
@@ -45,10 +45,9 @@ namespace SpawnHelpers {
       return false;
     }
 
-    auto calculateDistanceSquared = [](const std::shared_ptr<Entity> &entityA,
-                                       const std::shared_ptr<Entity> &entityB) -> float {
-      const auto centerA = entityA->getCenterPos();
-      const auto centerB = entityB->getCenterPos();
+    auto calculateDistanceSquared = [](const Entity &entityA, const Entity &entityB) -> float {
+      const auto centerA = entityA.getCenterPos();
+      const auto centerB = entityB.getCenterPos();
       return MathHelpers::pythagorasSquared(centerA.x - centerB.x, centerA.y - centerB.y);
     };
 
@@ -57,12 +56,20 @@ namespace SpawnHelpers {
       return false;
     }
 
-    auto collisionCheck = [&](const std::shared_ptr<Entity> &entityToCheck) -> bool {
+    auto collisionCheck = [&](const Entity &entityToCheck) -> bool {
       return CollisionHelpers::calculateCollisionBetweenEntities(entity, entityToCheck);
     };
 
+    // Entities spawned earlier in the same frame are only pending, but still take up space.
+    // The pending list includes the entity being placed, and spawns that were given up on.
+    auto pendingCollisionCheck = [&](const Entity &entityToCheck) -> bool {
+      return entityToCheck != entity && entityToCheck.isActive() &&
+             collisionCheck(entityToCheck);
+    };
+
     const bool isCollidingWithOtherEntities =
-        std::ranges::any_of(entityManager.getEntities(), collisionCheck);
+        std::ranges::any_of(entityManager.getEntities(), collisionCheck) ||
+        std::ranges::any_of(entityManager.getPendingEntities(), pendingCollisionCheck);
 
     if (isCollidingWithOtherEntities) {
       return false;
@@ -72,9 +79,9 @@ namespace SpawnHelpers {
 } // namespace SpawnHelpers
 
 namespace SpawnHelpers::MainScene {
-  std::shared_ptr<Entity> spawnPlayer(SDL_Renderer        *renderer,
-                                      const ConfigManager &configManager,
-                                      EntityManager       &entityManager) {
+  Entity spawnPlayer(SDL_Renderer        *renderer,
+                     const ConfigManager &configManager,
+                     EntityManager       &entityManager) {
 
     const PlayerConfig &playerConfig = configManager.getPlayerConfig();
     const GameConfig   &gameConfig   = configManager.getGameConfig();
@@ -87,27 +94,28 @@ namespace SpawnHelpers::MainScene {
     const Vec2 &playerPosition = centerPosition;
     const Vec2  playerVelocity = {0, 0};
 
-    const auto cShape     = std::make_shared<CShape>(renderer, playerConfig.shape);
-    const auto cTransform = std::make_shared<CTransform>(playerPosition, playerVelocity);
-    const auto cInput     = std::make_shared<CInput>();
-    const auto cEffects   = std::make_shared<CEffects>();
-
-    std::shared_ptr<Entity> player = entityManager.addEntity(EntityTags::Player);
-    player->setComponent(cTransform);
-    player->setComponent(cShape);
-    player->setComponent(cInput);
-    player->setComponent(cEffects);
+    const auto cShape     = CShape(renderer, playerConfig.shape);
+    const auto cTransform = CTransform(playerPosition, playerVelocity);
+    const auto cInput     = CInput();
+    const auto cEffects   = CEffects();
+    const auto cFilter    = CCollisionFilter(playerConfig.collision);
 
-    entityManager.update();
+    Entity player = entityManager.addEntity(EntityTags::Player);
+    player.setComponent(cTransform);
+    player.setComponent(cShape);
+    player.setComponent(cInput);
+    player.setComponent(cEffects);
+    player.setComponent(cFilter);
 
     return player;
   }
 
-  void spawnEnemy(SDL_Renderer                  *renderer,
-                  const ConfigManager           &configManager,
-                  std::mt19937                  &randomGenerator,
-                  EntityManager                 &entityManager,
-                  const std::shared_ptr<Entity> &player) {
+  void spawnEnemy(SDL_Renderer        *renderer,
+                  const ConfigManager &configManager,
+                  std::mt19937        &randomGenerator,
+                  EntityManager       &entityManager,
+                  const Entity        &player,
+                  const bool           checkPosition) {
     constexpr int MAX_SPAWN_ATTEMPTS = 10;
 
     const GameConfig  &gameConfig  = configManager.getGameConfig();
@@ -117,37 +125,41 @@ namespace SpawnHelpers::MainScene {
     const Vec2 velocity = createValidVelocity(randomGenerator);
     const Vec2 position = createRandomPosition(randomGenerator, windowSize);
 
-    const auto cTransform = std::make_shared<CTransform>(position, velocity);
-    const auto cShape     = std::make_shared<CShape>(renderer, enemyConfig.shape);
-    const auto cLifespan  = std::make_shared<CLifespan>(enemyConfig.lifespan);
+    const auto cTransform = CTransform(position, velocity);
+    const auto cMovement  = CLinearMovement(enemyConfig.speed);
+    const auto cShape     = CShape(renderer, enemyConfig.shape);
+    const auto cLifespan  = CLifespan(enemyConfig.lifespan);
+    const auto cFilter    = CCollisionFilter(enemyConfig.collision);
 
-    const std::shared_ptr<Entity> &enemy = entityManager.addEntity(EntityTags::Enemy);
-    enemy->setComponent<CTransform>(cTransform);
-    enemy->setComponent<CShape>(cShape);
-    enemy->setComponent<CLifespan>(cLifespan);
+    const Entity enemy = entityManager.addEntity(EntityTags::Enemy);
+    enemy.setComponent<CTransform>(cTransform);
+    enemy.setComponent<CLinearMovement>(cMovement);
+    enemy.setComponent<CShape>(cShape);
+    enemy.setComponent<CLifespan>(cLifespan);
+    enemy.setComponent<CCollisionFilter>(cFilter);
 
-    bool isValidSpawn = validateSpawnPosition(enemy, player, entityManager, windowSize);
-    int  spawnAttempt = 1;
+    bool isValidSpawn =
+        !checkPosition || validateSpawnPosition(enemy, player, entityManager, windowSize);
+    int spawnAttempt = 1;
 
     while (!isValidSpawn && spawnAttempt < MAX_SPAWN_ATTEMPTS) {
       const auto newPosition = createRandomPosition(randomGenerator, windowSize);
-      enemy->getComponent<CTransform>()->topLeftCornerPos = newPosition;
+      enemy.getComponent<CTransform>()->teleport(newPosition);
       isValidSpawn = validateSpawnPosition(enemy, player, entityManager, windowSize);
       spawnAttempt += 1;
     }
 
     if (!isValidSpawn) {
-      enemy->destroy();
+      enemy.destroy();
     }
-
-    entityManager.update();
   }
 
-  void spawnSpeedBoostEntity(SDL_Renderer                  *renderer,
-                             const ConfigManager           &configManager,
-                             std::mt19937                  &randomGenerator,
-                             EntityManager                 &entityManager,
-                             const std::shared_ptr<Entity> &player) {
+  void spawnSpeedBoostEntity(SDL_Renderer        *renderer,
+                             const ConfigManager &configManager,
+                             std::mt19937        &randomGenerator,
+                             EntityManager       &entityManager,
+                             const Entity        &player,
+                             const bool           checkPosition) {
     constexpr int MAX_SPAWN_ATTEMPTS = 10;
 
     const GameConfig        &gameConfig        = configManager.getGameConfig();
@@ -157,79 +169,85 @@ namespace SpawnHelpers::MainScene {
     const Vec2 velocity = createValidVelocity(randomGenerator);
     const Vec2 position = createRandomPosition(randomGenerator, windowSize);
 
-    const auto cTransform = std::make_shared<CTransform>(position, velocity);
-    const auto cShape     = std::make_shared<CShape>(renderer, speedEffectConfig.shape);
-    const auto cLifespan  = std::make_shared<CLifespan>(speedEffectConfig.lifespan);
+    const auto cTransform = CTransform(position, velocity);
+    const auto cMovement  = CLinearMovement(speedEffectConfig.speed);
+    const auto cShape     = CShape(renderer, speedEffectConfig.shape);
+    const auto cLifespan  = CLifespan(speedEffectConfig.lifespan);
+    const auto cFilter    = CCollisionFilter(speedEffectConfig.collision);
 
     const auto &speedBoost = entityManager.addEntity(EntityTags::SpeedBoost);
-    speedBoost->setComponent<CTransform>(cTransform);
-    speedBoost->setComponent<CShape>(cShape);
-    speedBoost->setComponent<CLifespan>(cLifespan);
+    speedBoost.setComponent<CTransform>(cTransform);
+    speedBoost.setComponent<CLinearMovement>(cMovement);
+    speedBoost.setComponent<CShape>(cShape);
+    speedBoost.setComponent<CLifespan>(cLifespan);
+    speedBoost.setComponent<CCollisionFilter>(cFilter);
 
-    bool isValidSpawn = validateSpawnPosition(speedBoost, player, entityManager, windowSize);
-    int  spawnAttempt = 1;
+    bool isValidSpawn =
+        !checkPosition || validateSpawnPosition(speedBoost, player, entityManager, windowSize);
+    int spawnAttempt = 1;
 
     while (!isValidSpawn && spawnAttempt < MAX_SPAWN_ATTEMPTS) {
       const auto newPosition = createRandomPosition(randomGenerator, windowSize);
-      speedBoost->getComponent<CTransform>()->topLeftCornerPos = newPosition;
+      speedBoost.getComponent<CTransform>()->teleport(newPosition);
       isValidSpawn = validateSpawnPosition(speedBoost, player, entityManager, windowSize);
       spawnAttempt += 1;
     }
 
     if (!isValidSpawn) {
-      speedBoost->destroy();
+      speedBoost.destroy();
     }
-
-    entityManager.update();
   }
 
-  void spawnSlownessEntity(SDL_Renderer                  *renderer,
-                           const ConfigManager           &configManager,
-                           std::mt19937                  &randomGenerator,
-                           EntityManager                 &entityManager,
-                           const std::shared_ptr<Entity> &player) {
+  void spawnSlownessEntity(SDL_Renderer        *renderer,
+                           const ConfigManager &configManager,
+                           std::mt19937        &randomGenerator,
+                           EntityManager       &entityManager,
+                           const Entity        &player,
+                           const bool           checkPosition) {
     constexpr int MAX_SPAWN_ATTEMPTS = 10;
 
-    const auto &[windowSize, windowTitle, fontPath, spawnInterval] =
-        configManager.getGameConfig();
+    const Vec2 &windowSize = configManager.getGameConfig().windowSize;
 
     const SlownessEffectConfig &slownessEffectConfig = configManager.getSlownessEffectConfig();
 
     const auto velocity = createValidVelocity(randomGenerator);
     const auto position = createRandomPosition(randomGenerator, windowSize);
 
-    const auto cTransform = std::make_shared<CTransform>(position, velocity);
-    const auto cShape     = std::make_shared<CShape>(renderer, slownessEffectConfig.shape);
-    const auto cLifespan  = std::make_shared<CLifespan>(slownessEffectConfig.lifespan);
+    const auto cTransform = CTransform(position, velocity);
+    const auto cMovement  = CLinearMovement(slownessEffectConfig.speed);
+    const auto cShape     = CShape(renderer, slownessEffectConfig.shape);
+    const auto cLifespan  = CLifespan(slownessEffectConfig.lifespan);
+    const auto cFilter    = CCollisionFilter(slownessEffectConfig.collision);
 
-    const std::shared_ptr<Entity> &slownessEntity =
-        entityManager.addEntity(EntityTags::SlownessDebuff);
+    const Entity slownessEntity = entityManager.addEntity(EntityTags::SlownessDebuff);
 
-    slownessEntity->setComponent<CTransform>(cTransform);
-    slownessEntity->setComponent<CShape>(cShape);
-    slownessEntity->setComponent<CLifespan>(cLifespan);
+    slownessEntity.setComponent<CTransform>(cTransform);
+    slownessEntity.setComponent<CLinearMovement>(cMovement);
+    slownessEntity.setComponent<CShape>(cShape);
+    slownessEntity.setComponent<CLifespan>(cLifespan);
+    slownessEntity.setComponent<CCollisionFilter>(cFilter);
 
     bool isValidSpawn =
+        !checkPosition ||
         validateSpawnPosition(slownessEntity, player, entityManager, windowSize);
     int spawnAttempt = 1;
 
     while (!isValidSpawn && spawnAttempt < MAX_SPAWN_ATTEMPTS) {
       const auto newPosition = createRandomPosition(randomGenerator, windowSize);
-      slownessEntity->getComponent<CTransform>()->topLeftCornerPos = newPosition;
+      slownessEntity.getComponent<CTransform>()->teleport(newPosition);
       isValidSpawn = validateSpawnPosition(slownessEntity, player, entityManager, windowSize);
       spawnAttempt += 1;
     }
 
     if (!isValidSpawn) {
-      slownessEntity->destroy();
+      slownessEntity.destroy();
     }
-
-    entityManager.update();
   }
 
   void spawnWalls(SDL_Renderer        *renderer,
                   const ConfigManager &configManager,
-                  EntityManager       &entityManager) {
+                  EntityManager       &entityManager,
+                  StaticBVH           &wallTree) {
 
     const GameConfig &gameConfig = configManager.getGameConfig();
 
@@ -238,9 +256,13 @@ namespace SpawnHelpers::MainScene {
     const float         wallWidth  = gameConfig.windowSize.x * 0.025f;
 
     const auto wallConfig = ShapeConfig(wallHeight, wallWidth, wallColor);
+    const auto wallFilter = CCollisionFilter(configManager.getWallConfig().collision);
 
     constexpr size_t WALL_COUNT = 8;
 
+    EntityVector walls;
+    walls.reserve(WALL_COUNT);
+
     const float innerWidth  = gameConfig.windowSize.x * 0.6f;
     const float innerHeight = gameConfig.windowSize.y * 0.6f;
     const float innerStartX = (gameConfig.windowSize.x - innerWidth) / 2;
@@ -256,10 +278,10 @@ namespace SpawnHelpers::MainScene {
     const float outerGapSize = outerWidth * 0.18f;
 
     for (int i = 0; i < WALL_COUNT; i++) {
-      const auto shapeComponent     = std::make_shared<CShape>(renderer, wallConfig);
-      const auto transformComponent = std::make_shared<CTransform>();
+      auto shapeComponent     = CShape(renderer, wallConfig);
+      auto transformComponent = CTransform();
 
-      Vec2 &topLeftCornerPos = transformComponent->topLeftCornerPos;
+      Vec2 &topLeftCornerPos = transformComponent.topLeftCornerPos;
 
       const bool isOuterWall       = i >= 4;
       const bool isHorizontal      = (i % 2 == 0);
@@ -269,63 +291,67 @@ namespace SpawnHelpers::MainScene {
       const bool isInnerVertical   = !isOuterWall && !isHorizontal;
 
       if (isOuterHorizontal) {
-        shapeComponent->rect.h = static_cast<int>(wallWidth);
-        shapeComponent->rect.w = static_cast<int>(outerWidth - (2 * outerGapSize));
+        shapeComponent.rect.h = static_cast<int>(wallWidth);
+        shapeComponent.rect.w = static_cast<int>(outerWidth - (2 * outerGapSize));
 
         topLeftCornerPos.x = outerStartX + outerGapSize;
         topLeftCornerPos.y = (i == 4) ? outerStartY : outerStartY + outerHeight - wallWidth;
       }
       if (isOuterVertical) {
-        shapeComponent->rect.h = static_cast<int>(outerHeight - (2 * outerGapSize));
-        shapeComponent->rect.w = static_cast<int>(wallWidth);
+        shapeComponent.rect.h = static_cast<int>(outerHeight - (2 * outerGapSize));
+        shapeComponent.rect.w = static_cast<int>(wallWidth);
 
         topLeftCornerPos.x = (i == 5) ? outerStartX : outerStartX + outerWidth - wallWidth;
         topLeftCornerPos.y = outerStartY + outerGapSize;
       }
       if (isInnerHorizontal) {
-        shapeComponent->rect.h = static_cast<int>(wallWidth);
-        shapeComponent->rect.w = static_cast<int>(innerWidth - (2 * innerGapSize));
+        shapeComponent.rect.h = static_cast<int>(wallWidth);
+        shapeComponent.rect.w = static_cast<int>(innerWidth - (2 * innerGapSize));
 
         topLeftCornerPos.x = innerStartX + innerGapSize;
         topLeftCornerPos.y = (i == 0) ? innerStartY : innerStartY + innerHeight - wallWidth;
       }
       if (isInnerVertical) {
-        shapeComponent->rect.h = static_cast<int>(innerHeight - (2 * innerGapSize));
-        shapeComponent->rect.w = static_cast<int>(wallWidth);
+        shapeComponent.rect.h = static_cast<int>(innerHeight - (2 * innerGapSize));
+        shapeComponent.rect.w = static_cast<int>(wallWidth);
 
         topLeftCornerPos.x = (i == 1) ? innerStartX : innerStartX + innerWidth - wallWidth;
         topLeftCornerPos.y = innerStartY + innerGapSize;
       }
 
-      const std::shared_ptr<Entity> wall = entityManager.addEntity(EntityTags::Wall);
-      wall->setComponent(shapeComponent);
-      wall->setComponent(transformComponent);
+      transformComponent.previousTopLeftCornerPos = topLeftCornerPos;
+
+      const Entity wall = entityManager.addEntity(EntityTags::Wall);
+      wall.setComponent(shapeComponent);
+      wall.setComponent(transformComponent);
+      wall.setComponent(wallFilter);
+      walls.push_back(wall);
     }
 
-    entityManager.update();
+    wallTree.build(walls);
   }
-  void spawnBullets(SDL_Renderer                  *renderer,
-                    const ConfigManager           &configManager,
-                    EntityManager                 &entityManager,
-                    const std::shared_ptr<Entity> &player,
-                    const Vec2                    &mousePosition) {
 
-    const EntityVector walls = entityManager.getEntities(EntityTags::Wall);
+  void spawnBullets(SDL_Renderer        *renderer,
+                    const ConfigManager &configManager,
+                    EntityManager       &entityManager,
+                    const StaticBVH     &wallTree,
+                    const Entity        &player,
+                    const Vec2          &mousePosition) {
 
-    const auto &[lifespan, speed, shape] = configManager.getBulletConfig();
+    const auto &[lifespan, speed, shape, collision] = configManager.getBulletConfig();
 
-    const Vec2 &playerCenter = player->getCenterPos();
+    const Vec2 &playerCenter = player.getCenterPos();
     const float playerHalfWidth =
-        static_cast<float>(player->getComponent<CShape>()->rect.w) / 2;
+        static_cast<float>(player.getComponent<CShape>()->rect.w) / 2;
 
     Vec2 direction;
     direction.x = mousePosition.x - playerCenter.x;
     direction.y = mousePosition.y - playerCenter.y;
     direction.normalize();
 
-    const float                   bulletSpeed    = speed;
-    Vec2                          bulletVelocity = direction * bulletSpeed;
-    const std::shared_ptr<Entity> bullet         = entityManager.addEntity(EntityTags::Bullet);
+    const float  bulletSpeed    = speed;
+    Vec2         bulletVelocity = direction * bulletSpeed;
+    const Entity bullet         = entityManager.addEntity(EntityTags::Bullet);
 
     const float bulletHalfWidth  = shape.width / 2;
     const float bulletHalfHeight = shape.height / 2;
@@ -337,64 +363,79 @@ namespace SpawnHelpers::MainScene {
     bulletPos.x = playerCenter.x + direction.x * spawnOffset - bulletHalfWidth;
     bulletPos.y = playerCenter.y + direction.y * spawnOffset - bulletHalfHeight;
 
-    const auto cTransform     = std::make_shared<CTransform>(bulletPos, bulletVelocity);
-    const auto cLifespan      = std::make_shared<CLifespan>(lifespan);
-    const auto cBounceTracker = std::make_shared<CBounceTracker>();
-    const auto cShape         = std::make_shared<CShape>(
+    // The configured speed sets the velocity, which bullets then cover three times per step
+    constexpr float BULLET_MOVEMENT_MULTIPLIER = 3.0f;
+
+    const auto cTransform     = CTransform(bulletPos, bulletVelocity);
+    const auto cMovement      = CLinearMovement(BULLET_MOVEMENT_MULTIPLIER);
+    const auto cLifespan      = CLifespan(lifespan);
+    const auto cBounceTracker = CBounceTracker();
+    const auto cFilter        = CCollisionFilter(collision);
+    const auto cShape         = CShape(
         renderer, ShapeConfig(shape.height, shape.width, shape.color));
 
-    bullet->setComponent<CShape>(cShape);
-    bullet->setComponent<CTransform>(cTransform);
-    bullet->setComponent<CLifespan>(cLifespan);
-    bullet->setComponent<CBounceTracker>(cBounceTracker);
+    bullet.setComponent<CShape>(cShape);
+    bullet.setComponent<CTransform>(cTransform);
+    bullet.setComponent<CLinearMovement>(cMovement);
+    bullet.setComponent<CLifespan>(cLifespan);
+    bullet.setComponent<CBounceTracker>(cBounceTracker);
+    bullet.setComponent<CCollisionFilter>(cFilter);
 
-    for (const std::shared_ptr<Entity> &wall : walls) {
+    EntityVector nearbyWalls;
+    wallTree.query(*CollisionHelpers::calculateBoundingBox(bullet), nearbyWalls);
+
+    for (const Entity &wall : nearbyWalls) {
       if (CollisionHelpers::calculateCollisionBetweenEntities(bullet, wall)) {
-        bullet->destroy();
+        bullet.destroy();
         break;
       }
     }
-
-    entityManager.update();
   }
 
-  void spawnItem(SDL_Renderer                  *renderer,
-                 const ConfigManager           &configManager,
-                 std::mt19937                  &randomGenerator,
-                 EntityManager                 &entityManager,
-                 const std::shared_ptr<Entity> &player) {
+  void spawnItem(SDL_Renderer        *renderer,
+                 const ConfigManager &configManager,
+                 std::mt19937        &randomGenerator,
+                 EntityManager       &entityManager,
+                 const Entity        &player,
+                 const bool           checkPosition) {
     constexpr int MAX_SPAWN_ATTEMPTS = 10;
 
-    const GameConfig &gameConfig                          = configManager.getGameConfig();
-    const auto &[spawnPercentage, lifespan, speed, shape] = configManager.getItemConfig();
-    const Vec2 &windowSize                                = gameConfig.windowSize;
+    const GameConfig &gameConfig = configManager.getGameConfig();
+    const auto &[spawnPercentage, lifespan, speed, shape, collision] =
+        configManager.getItemConfig();
+    const Vec2 &windowSize = gameConfig.windowSize;
+
+    constexpr float ITEM_DRIFT_SPEED = .9f;
 
     const auto position   = createRandomPosition(randomGenerator, windowSize);
     const auto velocity   = Vec2(0, 0);
-    const auto cTransform = std::make_shared<CTransform>(position, velocity);
-    const auto cShape     = std::make_shared<CShape>(renderer, shape);
-    const auto cLifespan  = std::make_shared<CLifespan>(lifespan);
+    const auto cTransform = CTransform(position, velocity);
+    const auto cMovement  = CDriftMovement(ITEM_DRIFT_SPEED);
+    const auto cShape     = CShape(renderer, shape);
+    const auto cLifespan  = CLifespan(lifespan);
+    const auto cFilter    = CCollisionFilter(collision);
 
     const auto &item = entityManager.addEntity(EntityTags::Item);
-    item->setComponent<CTransform>(cTransform);
-    item->setComponent<CShape>(cShape);
-    item->setComponent<CLifespan>(cLifespan);
+    item.setComponent<CTransform>(cTransform);
+    item.setComponent<CDriftMovement>(cMovement);
+    item.setComponent<CShape>(cShape);
+    item.setComponent<CLifespan>(cLifespan);
+    item.setComponent<CCollisionFilter>(cFilter);
 
-    bool isValidSpawn = validateSpawnPosition(item, player, entityManager, windowSize);
-    int  spawnAttempt = 1;
+    bool isValidSpawn =
+        !checkPosition || validateSpawnPosition(item, player, entityManager, windowSize);
+    int spawnAttempt = 1;
 
     while (!isValidSpawn && spawnAttempt < MAX_SPAWN_ATTEMPTS) {
       const auto newPosition = createRandomPosition(randomGenerator, windowSize);
-      item->getComponent<CTransform>()->topLeftCornerPos = newPosition;
+      item.getComponent<CTransform>()->teleport(newPosition);
 
       isValidSpawn = validateSpawnPosition(item, player, entityManager, windowSize);
       spawnAttempt += 1;
     }
 
     if (!isValidSpawn) {
-      item->destroy();
+      item.destroy();
     }
-
-    entityManager.update();
   }
 } // namespace SpawnHelpers::MainScene
\ No newline at end of file
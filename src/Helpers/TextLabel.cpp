@@ -0,0 +1,115 @@
+#include "../../includes/Helpers/TextLabel.hpp"
+#include "../../includes/GameEngine/TraceRecorder.hpp"
+
+#include <utility>
+
+TextLabel::TextLabel(const GlyphAtlas *font,
+                     std::string       text,
+                     const SDL_Color  &color,
+                     const Vec2       &position) :
+    m_font(font), m_text(std::move(text)), m_color(color), m_position(position) {}
+
+TextLabel::~TextLabel() {
+  destroyTexture();
+}
+
+TextLabel::TextLabel(TextLabel &&other) noexcept :
+    m_font(other.m_font),
+    m_text(std::move(other.m_text)),
+    m_color(other.m_color),
+    m_position(other.m_position),
+    m_texture(std::exchange(other.m_texture, nullptr)),
+    m_width(other.m_width),
+    m_height(other.m_height),
+    m_dirty(other.m_dirty) {}
+
+TextLabel &TextLabel::operator=(TextLabel &&other) noexcept {
+  if (this != &other) {
+    destroyTexture();
+    m_font     = other.m_font;
+    m_text     = std::move(other.m_text);
+    m_color    = other.m_color;
+    m_position = other.m_position;
+    m_texture  = std::exchange(other.m_texture, nullptr);
+    m_width    = other.m_width;
+    m_height   = other.m_height;
+    m_dirty    = other.m_dirty;
+  }
+  return *this;
+}
+
+void TextLabel::setText(const std::string &text) {
+  if (text == m_text) {
+    return;
+  }
+  m_text  = text;
+  m_dirty = true;
+}
+
+void TextLabel::setColor(const SDL_Color &color) {
+  m_color = color;
+}
+
+void TextLabel::setPosition(const Vec2 &position) {
+  m_position = position;
+}
+
+void TextLabel::render(SDL_Renderer *renderer) {
+  if (m_dirty) {
+    rasterize(renderer);
+  }
+
+  if (m_texture == nullptr) {
+    return;
+  }
+
+  SDL_SetTextureColorMod(m_texture, m_color.r, m_color.g, m_color.b);
+  SDL_SetTextureAlphaMod(m_texture, m_color.a);
+
+  const SDL_Rect destination = {.x = static_cast<int>(m_position.x),
+                                .y = static_cast<int>(m_position.y),
+                                .w = m_width,
+                                .h = m_height};
+  SDL_RenderCopy(renderer, m_texture, nullptr, &destination);
+}
+
+void TextLabel::rasterize(SDL_Renderer *renderer) {
+  const TraceRecorder::Scope trace("TextLabel::rasterize");
+
+  destroyTexture();
+  m_dirty = false;
+
+  // SDL_ttf cannot render an empty string, and there is nothing to draw anyway
+  if (m_font == nullptr || m_text.empty()) {
+    return;
+  }
+
+  // Rendered white, so the color can be applied as a modulation when drawing
+  constexpr SDL_Color white   = {.r = 255, .g = 255, .b = 255, .a = 255};
+  SDL_Surface        *surface = TTF_RenderText_Solid(m_font->getFont(), m_text.c_str(), white);
+  if (surface == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Failed to create surface for text label: %s",
+                 TTF_GetError());
+    return;
+  }
+
+  m_texture = SDL_CreateTextureFromSurface(renderer, surface);
+  m_width   = surface->w;
+  m_height  = surface->h;
+  SDL_FreeSurface(surface);
+
+  if (m_texture == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Failed to create texture for text label: %s",
+                 SDL_GetError());
+    return;
+  }
+
+  SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_BLEND);
+}
+
+void TextLabel::destroyTexture() {
+  if (m_texture != nullptr) {
+    SDL_DestroyTexture(m_texture);
+    m_texture = nullptr;
+  }
+}
@@ -0,0 +1,57 @@
+#include "../../includes/RenderManagement/CachedFrame.hpp"
+
+CachedFrame::~CachedFrame() {
+  if (m_texture != nullptr) {
+    SDL_DestroyTexture(m_texture);
+    m_texture = nullptr;
+  }
+}
+
+void CachedFrame::invalidate() {
+  m_dirty = true;
+}
+
+bool CachedFrame::needsRedraw(SDL_Renderer *renderer) const {
+  int width  = 0;
+  int height = 0;
+  SDL_GetRendererOutputSize(renderer, &width, &height);
+
+  return m_dirty || width != m_width || height != m_height;
+}
+
+bool CachedFrame::beginRedraw(SDL_Renderer *renderer) {
+  if (!SDL_RenderTargetSupported(renderer)) {
+    return false;
+  }
+
+  int width  = 0;
+  int height = 0;
+  SDL_GetRendererOutputSize(renderer, &width, &height);
+
+  if (m_texture == nullptr || width != m_width || height != m_height) {
+    if (m_texture != nullptr) {
+      SDL_DestroyTexture(m_texture);
+    }
+
+    m_texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                  width, height);
+    m_width   = width;
+    m_height  = height;
+
+    if (m_texture == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Failed to create cached frame texture: %s",
+                   SDL_GetError());
+      return false;
+    }
+
+    // The frame includes its background, so copying it replaces what is underneath
+    SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_NONE);
+  }
+
+  return SDL_SetRenderTarget(renderer, m_texture) == 0;
+}
+
+void CachedFrame::endRedraw(SDL_Renderer *renderer) {
+  SDL_SetRenderTarget(renderer, nullptr);
+  m_dirty = false;
+}
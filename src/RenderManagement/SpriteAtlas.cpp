@@ -0,0 +1,129 @@
+#include "../../includes/RenderManagement/SpriteAtlas.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+SpriteAtlas::SpriteAtlas() {
+  constexpr int SOLID_SIZE = 4;
+
+  SDL_Surface *solid =
+      SDL_CreateRGBSurfaceWithFormat(0, SOLID_SIZE, SOLID_SIZE, 32, SDL_PIXELFORMAT_RGBA32);
+  if (solid == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Failed to create solid sprite: %s", SDL_GetError());
+    throw std::runtime_error("Failed to create solid sprite");
+  }
+
+  SDL_FillRect(solid, nullptr, SDL_MapRGBA(solid->format, 255, 255, 255, 255));
+  m_images.push_back(solid);
+}
+
+SpriteAtlas::~SpriteAtlas() {
+  freeImages();
+  if (m_texture != nullptr) {
+    SDL_DestroyTexture(m_texture);
+    m_texture = nullptr;
+  }
+}
+
+void SpriteAtlas::freeImages() {
+  for (SDL_Surface *image : m_images) {
+    SDL_FreeSurface(image);
+  }
+  m_images.clear();
+}
+
+size_t SpriteAtlas::addImage(const SDL_Surface *image) {
+  if (m_texture != nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Failed to add sprite: Atlas is already built.");
+    throw std::runtime_error("Failed to add sprite: Atlas is already built.");
+  }
+
+  SDL_Surface *copy = SDL_ConvertSurfaceFormat(const_cast<SDL_Surface *>(image),
+                                               SDL_PIXELFORMAT_RGBA32, 0);
+  if (copy == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Failed to copy sprite: %s", SDL_GetError());
+    throw std::runtime_error("Failed to copy sprite");
+  }
+
+  m_images.push_back(copy);
+  return m_images.size() - 1;
+}
+
+void SpriteAtlas::build(SDL_Renderer *renderer) {
+  constexpr int MAX_ATLAS_WIDTH = 1024;
+  constexpr int PADDING         = 1;
+
+  // Shelf-pack the images in the order they were added
+  std::vector<SDL_Rect> placements;
+  placements.reserve(m_images.size());
+
+  int penX        = PADDING;
+  int penY        = PADDING;
+  int rowHeight   = 0;
+  int atlasHeight = 0;
+
+  for (const SDL_Surface *image : m_images) {
+    if (penX + image->w + PADDING > MAX_ATLAS_WIDTH) {
+      penX = PADDING;
+      penY += rowHeight + PADDING;
+      rowHeight = 0;
+    }
+
+    placements.push_back({.x = penX, .y = penY, .w = image->w, .h = image->h});
+
+    penX += image->w + PADDING;
+    rowHeight   = std::max(rowHeight, image->h);
+    atlasHeight = std::max(atlasHeight, penY + rowHeight + PADDING);
+  }
+
+  SDL_Surface *atlasSurface = SDL_CreateRGBSurfaceWithFormat(
+      0, MAX_ATLAS_WIDTH, atlasHeight, 32, SDL_PIXELFORMAT_RGBA32);
+  if (atlasSurface == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Failed to create sprite atlas surface: %s",
+                 SDL_GetError());
+    throw std::runtime_error("Failed to create sprite atlas surface");
+  }
+
+  SDL_FillRect(atlasSurface, nullptr, SDL_MapRGBA(atlasSurface->format, 0, 0, 0, 0));
+  for (size_t index = 0; index < m_images.size(); index++) {
+    // Copy the pixels as they are instead of blending them onto the transparent background
+    SDL_SetSurfaceBlendMode(m_images[index], SDL_BLENDMODE_NONE);
+    SDL_Rect destination = placements[index];
+    SDL_BlitSurface(m_images[index], nullptr, atlasSurface, &destination);
+  }
+  freeImages();
+
+  m_texture = SDL_CreateTextureFromSurface(renderer, atlasSurface);
+  SDL_FreeSurface(atlasSurface);
+
+  if (m_texture == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Failed to create sprite atlas texture: %s",
+                 SDL_GetError());
+    throw std::runtime_error("Failed to create sprite atlas texture");
+  }
+  SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_BLEND);
+
+  const auto width  = static_cast<float>(MAX_ATLAS_WIDTH);
+  const auto height = static_cast<float>(atlasHeight);
+
+  m_regions.clear();
+  m_regions.reserve(placements.size());
+  for (const SDL_Rect &placement : placements) {
+    m_regions.push_back({.x = static_cast<float>(placement.x) / width,
+                         .y = static_cast<float>(placement.y) / height,
+                         .w = static_cast<float>(placement.w) / width,
+                         .h = static_cast<float>(placement.h) / height});
+  }
+
+  // Shapes only need one color, so sample the middle of the solid block
+  SDL_FRect &solid = m_regions[SOLID_REGION];
+  solid            = {.x = solid.x + solid.w / 2, .y = solid.y + solid.h / 2, .w = 0, .h = 0};
+}
+
+SDL_Texture *SpriteAtlas::getTexture() const {
+  return m_texture;
+}
+
+const SDL_FRect &SpriteAtlas::getRegion(const size_t region) const {
+  return m_regions.at(region);
+}
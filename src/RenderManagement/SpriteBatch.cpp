@@ -0,0 +1,35 @@
+#include "../../includes/RenderManagement/SpriteBatch.hpp"
+
+void SpriteBatch::clear() {
+  m_vertices.clear();
+  m_indices.clear();
+}
+
+void SpriteBatch::add(const SDL_FRect &destination,
+                      const SDL_FRect &source,
+                      const SDL_Color &color) {
+  const auto  first  = static_cast<int>(m_vertices.size());
+  const float left   = destination.x;
+  const float top    = destination.y;
+  const float right  = destination.x + destination.w;
+  const float bottom = destination.y + destination.h;
+
+  m_vertices.push_back({{left, top}, color, {source.x, source.y}});
+  m_vertices.push_back({{right, top}, color, {source.x + source.w, source.y}});
+  m_vertices.push_back({{right, bottom}, color, {source.x + source.w, source.y + source.h}});
+  m_vertices.push_back({{left, bottom}, color, {source.x, source.y + source.h}});
+
+  // Two triangles per quad
+  m_indices.insert(m_indices.end(),
+                   {first, first + 1, first + 2, first, first + 2, first + 3});
+}
+
+void SpriteBatch::submit(SDL_Renderer *renderer, SDL_Texture *texture) const {
+  if (m_indices.empty()) {
+    return;
+  }
+
+  SDL_RenderGeometry(renderer, texture, m_vertices.data(),
+                     static_cast<int>(m_vertices.size()), m_indices.data(),
+                     static_cast<int>(m_indices.size()));
+}
@@ -5,8 +5,14 @@
 AudioManager::AudioManager(const int    frequency,
                            const Uint16 format,
                            const int    channels,
-                           const int    chunksize) :
+                           const int    chunksize,
+                           const bool   headless) :
     m_frequency(frequency), m_format(format), m_channels(channels), m_chunksize(chunksize) {
+  // The dummy driver accepts and discards all output, so no sound card is needed
+  if (headless) {
+    SDL_SetHint(SDL_HINT_AUDIODRIVER, "dummy");
+  }
+
   if (SDL_Init(SDL_INIT_AUDIO) != 0) {
     throw std::runtime_error("SDL_Init failed");
   }
@@ -9,10 +9,13 @@
 
 typedef std::filesystem::path Path;
 
-VideoManager::VideoManager(ConfigManager &configManager) :
-    m_configManager(configManager) {
-  const auto &[windowSize, windowTitle, fontPath, spawnInterval] =
-      m_configManager.getGameConfig();
+VideoManager::VideoManager(ConfigManager &configManager, const bool headless) :
+    m_headless(headless), m_configManager(configManager) {
+  if (m_headless) {
+    m_renderer = createHeadlessRenderer();
+    setupRenderer();
+    return;
+  }
 
   initializeVideoSystem();
   m_window   = createWindow();
@@ -50,8 +53,9 @@ SDL_Window *VideoManager::createWindow() {
   windowFlags |= macFlags;
 #endif
 
-  const auto &[windowSize, windowTitle, fontPath, spawnInterval] =
-      m_configManager.getGameConfig();
+  const GameConfig  &gameConfig  = m_configManager.getGameConfig();
+  const Vec2        &windowSize  = gameConfig.windowSize;
+  const std::string &windowTitle = gameConfig.windowTitle;
 
   SDL_Window *window = SDL_CreateWindow(windowTitle.c_str(), SDL_WINDOWPOS_CENTERED,
                                         SDL_WINDOWPOS_CENTERED, static_cast<int>(windowSize.x),
@@ -75,7 +79,40 @@ SDL_Window *VideoManager::createWindow() {
   return window;
 }
 
+/**
+ * @brief Creates a software renderer that draws into a 1x1 surface.
+ *
+ * Nothing is ever shown, but every draw call the scenes make stays valid, so the game runs
+ * without a display. The logical window size is taken from the configuration instead.
+ *
+ * @throws std::runtime_error If the surface or the renderer could not be created.
+ */
+SDL_Renderer *VideoManager::createHeadlessRenderer() {
+  m_surface = SDL_CreateRGBSurfaceWithFormat(0, 1, 1, 32, SDL_PIXELFORMAT_RGBA8888);
+  if (m_surface == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Headless surface could not be created: %s",
+                 SDL_GetError());
+    throw std::runtime_error("Headless surface could not be created");
+  }
+
+  SDL_Renderer *renderer = SDL_CreateSoftwareRenderer(m_surface);
+  if (renderer == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Headless renderer could not be created: %s",
+                 SDL_GetError());
+    throw std::runtime_error("Headless renderer could not be created");
+  }
+
+  m_currentWindowSize = m_configManager.getGameConfig().windowSize;
+
+  SDL_LogInfo(SDL_LOG_CATEGORY_VIDEO, "Headless renderer created successfully!");
+  return renderer;
+}
+
 void VideoManager::updateWindowSize() {
+  if (m_window == nullptr) {
+    return;
+  }
+
   int currentWindowWidth, currentWindowHeight;
   int drawableWidth, drawableHeight;
 
@@ -90,7 +127,7 @@ void VideoManager::updateWindowSize() {
 }
 
 /**
- * @brief Create a renderer
+ * @brief Create a renderer, synchronized to the display's refresh when vsync is configured
  * @throws std::runtime_error if window is not initialized
  * @throws std::runtime_error if renderer could not be created
  */
@@ -100,7 +137,12 @@ SDL_Renderer *VideoManager::createRenderer() const {
     throw std::runtime_error("Window is not initialized");
   }
 
-  SDL_Renderer *renderer = SDL_CreateRenderer(m_window, -1, SDL_RENDERER_ACCELERATED);
+  Uint32 rendererFlags = SDL_RENDERER_ACCELERATED;
+  if (m_configManager.getGameConfig().vsync) {
+    rendererFlags |= SDL_RENDERER_PRESENTVSYNC;
+  }
+
+  SDL_Renderer *renderer = SDL_CreateRenderer(m_window, -1, rendererFlags);
   if (renderer == nullptr) {
     SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Renderer could not be created: %s", SDL_GetError());
     throw std::runtime_error("Renderer could not be created");
@@ -130,6 +172,18 @@ void VideoManager::setupRenderer() const {
 Vec2 VideoManager::getWindowSize() const {
   return m_currentWindowSize;
 }
+
+const Vec2 &VideoManager::getCameraPosition() const {
+  return m_cameraPosition;
+}
+
+void VideoManager::setCameraPosition(const Vec2 &position) {
+  m_cameraPosition = position;
+}
+
+BoundingBox VideoManager::getCameraBounds() const {
+  return {.min = m_cameraPosition, .max = m_cameraPosition + m_currentWindowSize};
+}
 SDL_Renderer *VideoManager::getRenderer() const {
   return m_renderer;
 }
@@ -151,6 +205,11 @@ void VideoManager::cleanup() {
     SDL_LogInfo(SDL_LOG_CATEGORY_VIDEO, "Window destroyed successfully!");
   }
 
+  if (m_surface != nullptr) {
+    SDL_FreeSurface(m_surface);
+    m_surface = nullptr;
+  }
+
   SDL_QuitSubSystem(SDL_INIT_VIDEO);
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "VideoManager cleaned up successfully!");
 }
@@ -1,16 +1,85 @@
 #include "../includes/GameEngine/GameEngine.hpp"
+#include "../includes/GameEngine/TraceRecorder.hpp"
 #include <SDL_main.h>
+#include <charconv>
+#include <stdexcept>
+#include <string>
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten.h>
 #endif
 
+constexpr const char *USAGE =
+    "Usage: SDL_GAME [--headless] [--frames N] [--benchmark N] [--trace FILE]";
+
+// Reads a whole argument as a non-negative count
+static bool parseCount(const std::string &argument, Uint64 &count) {
+  const char *end              = argument.data() + argument.size();
+  const auto [position, error] = std::from_chars(argument.data(), end, count);
+  return error == std::errc() && position == end && !argument.empty();
+}
+
 int main(int argc, char *argv[]) {
 #ifndef __EMSCRIPTEN__
   SDL_LogSetAllPriority(SDL_LOG_PRIORITY_VERBOSE);
 #endif
-  auto gameEngine = GameEngine();
-  gameEngine.run();
+
+  // --headless runs MainScene without a window or audio device, --frames N stops after N
+  // frames, --benchmark N runs a headless benchmark with N entities, and --trace FILE writes
+  // a Chrome trace of every frame to FILE
+  bool   headless             = false;
+  Uint64 maxFrames            = 0;
+  size_t benchmarkEntityCount = 0;
+  for (int index = 1; index < argc; index++) {
+    const std::string argument = argv[index];
+    if (argument == "--headless") {
+      headless = true;
+      continue;
+    }
+
+    if (argument != "--frames" && argument != "--benchmark" && argument != "--trace") {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unknown argument: %s", argv[index]);
+      SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "%s", USAGE);
+      return 1;
+    }
+
+    // The remaining options all take a value
+    if (index + 1 >= argc) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Missing value for %s", argv[index]);
+      SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "%s", USAGE);
+      return 1;
+    }
+    const std::string value = argv[++index];
+
+    if (argument == "--frames") {
+      if (!parseCount(value, maxFrames)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Invalid frame count: %s", value.c_str());
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "%s", USAGE);
+        return 1;
+      }
+    } else if (argument == "--benchmark") {
+      Uint64 entityCount = 0;
+      if (!parseCount(value, entityCount)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Invalid entity count: %s", value.c_str());
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "%s", USAGE);
+        return 1;
+      }
+      headless             = true;
+      benchmarkEntityCount = entityCount;
+    } else {
+      // A trace is only a diagnostic, so the game still runs when the file cannot be opened
+      try {
+        TraceRecorder::start(value);
+      } catch (const std::runtime_error &) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Continuing without a trace");
+      }
+    }
+  }
+
+  auto gameEngine = GameEngine(headless, benchmarkEntityCount);
+  gameEngine.run(maxFrames);
+
+  TraceRecorder::stop();
 
   return 0;
 }
\ No newline at end of file